@@ -9,7 +9,7 @@ namespace duckdb {
 #define DISTRIBUTION_NAME       bernoulli_distribution
 
 #define DISTRIBUTION        boost::math::DISTRIBUTION_NAME<double>
-#define SAMPLE_DISTRIBUTION boost::random::DISTRIBUTION_NAME<double>
+#define SAMPLE_DISTRIBUTION bernoulli_sampler<bool>
 #define REGISTER            RegisterFunction<DISTRIBUTION>
 
 template <typename DistType>
@@ -24,6 +24,10 @@ struct distribution_traits_base {
 		return {logical_type_map<param1_t>::Get()};
 	}
 
+	static bool ParametersValid(param1_t p) {
+		return (p >= 0) & (p <= 1);
+	}
+
 	static void ValidateParameters(param1_t p) {
 		if (p < 0 || p > 1) {
 			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) +
@@ -39,6 +43,10 @@ struct distribution_traits_base {
 DEFINE_DIST_TRAITS(DISTRIBUTION);
 DEFINE_DIST_TRAITS(SAMPLE_DISTRIBUTION);
 
+// Reduced precision instantiation used when stochastic_precision is 'fast'
+#define FAST_DISTRIBUTION boost::math::DISTRIBUTION_NAME<double, fast_precision_policy>
+DEFINE_DIST_TRAITS(FAST_DISTRIBUTION);
+
 #define CONCAT(a, b)            a##b
 #define EXPAND_AND_CONCAT(a, b) CONCAT(a, b)
 
@@ -46,25 +54,40 @@ DEFINE_DIST_TRAITS(SAMPLE_DISTRIBUTION);
 
 LOAD_DISTRIBUTION_FN {
 	vector<std::pair<string, LogicalType>> param_names_quantile = {{"p", LogicalType::DOUBLE}};
+	vector<std::pair<string, LogicalType>> param_names_quantiles = {{"p", LogicalType::LIST(LogicalType::DOUBLE)}};
 	vector<std::pair<string, LogicalType>> param_names_unary = {{"x", LogicalType::DOUBLE}};
 
 	auto make_unary = [](auto func) {
 		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
-			DistributionCallUnaryUnary<DISTRIBUTION, double>(args, state, result, func);
+			if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+				DistributionCallUnary<FAST_DISTRIBUTION, double>(args, state, result, func);
+			} else {
+				DistributionCallUnary<DISTRIBUTION, double>(args, state, result, func);
+			}
+		};
+	};
+
+	auto make_list = [](auto func) {
+		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
+			if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+				DistributionCallList<FAST_DISTRIBUTION>(args, state, result, func);
+			} else {
+				DistributionCallList<DISTRIBUTION>(args, state, result, func);
+			}
 		};
 	};
 
 	auto make_none = [](auto func) {
 		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
-			DistributionCallUnaryNone<DISTRIBUTION>(args, state, result,
-			                                        [func](Vector &result, const auto &dist) { return func(dist); });
+			DistributionCallNone<DISTRIBUTION>(args, state, result,
+			                                   [func](Vector &result, const auto &dist) { return func(dist); });
 		};
 	};
 
 	REGISTER(
 	    loader, "sample", FunctionStability::VOLATILE, LogicalType::BOOLEAN,
 	    [](DataChunk &args, ExpressionState &state, Vector &result) {
-		    DistributionSampleUnary<SAMPLE_DISTRIBUTION, bool>(args, state, result);
+		    DistributionSampleBatch<SAMPLE_DISTRIBUTION, bool>(args, state, result);
 	    },
 	    "Generates random samples from the " + DISTRIBUTION_TEXT + " with specified parameters.", "sample(0.5)");
 
@@ -134,6 +157,13 @@ LOAD_DISTRIBUTION_FN {
 	             "such that P(X > x) = p, useful for computing upper tail quantiles.",
 	         "quantile_complement(0.5, 0.05)", param_names_quantile);
 
+	REGISTER(
+	    loader, "quantiles", FunctionStability::CONSISTENT, LogicalType::LIST(LogicalType::DOUBLE),
+	    make_list([](const auto &dist, auto p) -> DISTRIBUTION::value_type { return boost::math::quantile(dist, p); }),
+	    "Computes the quantile function of the " + DISTRIBUTION_TEXT +
+	        " at every probability of a list, building the distribution once for the row.",
+	    "quantiles(0.5, [0.05, 0.5, 0.95])", param_names_quantiles);
+
 	REGISTER(
 	    loader, "hazard", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
 	    make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::hazard(dist, x); }),
@@ -144,8 +174,29 @@ LOAD_DISTRIBUTION_FN {
 	         "Computes the cumulative hazard function of the " + DISTRIBUTION_TEXT + ".", "chf(0.5, 0)",
 	         param_names_unary);
 
+	REGISTER(
+	    loader, "eval", FunctionStability::CONSISTENT, DistributionEvalType(),
+	    [](DataChunk &args, ExpressionState &state, Vector &result) {
+		    if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+			    DistributionCallEval<FAST_DISTRIBUTION, double>(args, state, result);
+		    } else {
+			    DistributionCallEval<DISTRIBUTION, double>(args, state, result);
+		    }
+	    },
+	    "Evaluates the PDF, log-PDF, CDF, survival function and hazard of the " + DISTRIBUTION_TEXT +
+	        " at x as one struct, computing the PDF and survival function once for all of them.",
+	    "eval(0.5, 0)", param_names_unary);
+
 	// === DISTRIBUTION PROPERTIES ===
 
+	REGISTER(loader, "summary", FunctionStability::CONSISTENT, DistributionSummaryType(),
+	         [](DataChunk &args, ExpressionState &state, Vector &result) {
+		         DistributionCallSummary<DISTRIBUTION>(args, state, result);
+	         },
+	         "Returns the mean, variance, standard deviation, skewness, kurtosis, median and mode of the " +
+	             DISTRIBUTION_TEXT + " as one struct. Moments that are undefined for the parameters are NULL.",
+	         "summary(0.5)");
+
 	REGISTER(loader, "mean", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
 	         make_none([](const auto &dist) { return boost::math::mean(dist); }),
 	         "Returns the mean (μ) of the " + DISTRIBUTION_TEXT + ", which is the first moment.", "mean(0.5)");
@@ -187,5 +238,8 @@ LOAD_DISTRIBUTION_FN {
 	REGISTER(loader, "support", FunctionStability::CONSISTENT, LogicalType::ARRAY(LogicalType::DOUBLE, 2),
 	         make_none([](const auto &dist) { return boost::math::support(dist); }),
 	         "Returns the support of the " + DISTRIBUTION_TEXT + ".", "support(0.5)");
+
+	// === DISTRIBUTION VALUE ===
+	RegisterDistributionConstructor<DISTRIBUTION>(loader, DISTRIBUTION_TEXT, "0.5");
 }
 } // end namespace duckdb
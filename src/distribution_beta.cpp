@@ -9,7 +9,8 @@ namespace duckdb {
 #define DISTRIBUTION_NAME       beta_distribution
 
 #define DISTRIBUTION        boost::math::DISTRIBUTION_NAME<double>
-#define SAMPLE_DISTRIBUTION boost::random::DISTRIBUTION_NAME<double>
+#define SAMPLE_DISTRIBUTION beta_sampler<double>
+#define CDF_KERNEL          beta_cdf_kernel
 #define REGISTER            RegisterFunction<DISTRIBUTION>
 
 template <typename DistType>
@@ -25,6 +26,10 @@ struct distribution_traits_base {
 		return {logical_type_map<param1_t>::Get(), logical_type_map<param2_t>::Get()};
 	}
 
+	static bool ParametersValid(param1_t alpha, param2_t beta) {
+		return (alpha > 0) & (beta > 0) & std::isfinite(alpha) & std::isfinite(beta);
+	}
+
 	static void ValidateParameters(param1_t alpha, param2_t beta) {
 		if (alpha <= 0) {
 			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) +
@@ -34,6 +39,14 @@ struct distribution_traits_base {
 			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) +
 			                            ": Beta must be > 0 was: " + std::to_string(beta));
 		}
+		if (std::isinf(alpha)) {
+			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) +
+			                            ": Alpha must be finite was: " + std::to_string(alpha));
+		}
+		if (std::isinf(beta)) {
+			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) +
+			                            ": Beta must be finite was: " + std::to_string(beta));
+		}
 	}
 };
 
@@ -44,6 +57,20 @@ struct distribution_traits_base {
 DEFINE_DIST_TRAITS(DISTRIBUTION);
 DEFINE_DIST_TRAITS(SAMPLE_DISTRIBUTION);
 
+// Reduced precision instantiation used when stochastic_precision is 'fast'
+#define FAST_DISTRIBUTION boost::math::DISTRIBUTION_NAME<double, fast_precision_policy>
+DEFINE_DIST_TRAITS(FAST_DISTRIBUTION);
+
+// Single precision instantiations backing the FLOAT overloads
+#define FLOAT_DISTRIBUTION        boost::math::DISTRIBUTION_NAME<float>
+#define FLOAT_SAMPLE_DISTRIBUTION beta_sampler<float>
+#define DEFINE_FLOAT_DIST_TRAITS(DIST)                                                                                 \
+	template <>                                                                                                        \
+	struct distribution_traits<DIST> : public real_distribution_traits<distribution_traits_base<DIST>, float> {};
+
+DEFINE_FLOAT_DIST_TRAITS(FLOAT_DISTRIBUTION);
+DEFINE_FLOAT_DIST_TRAITS(FLOAT_SAMPLE_DISTRIBUTION);
+
 #define CONCAT(a, b)            a##b
 #define EXPAND_AND_CONCAT(a, b) CONCAT(a, b)
 
@@ -51,25 +78,52 @@ DEFINE_DIST_TRAITS(SAMPLE_DISTRIBUTION);
 
 LOAD_DISTRIBUTION_FN {
 	vector<std::pair<string, LogicalType>> param_names_quantile = {{"p", LogicalType::DOUBLE}};
+	vector<std::pair<string, LogicalType>> param_names_quantiles = {{"p", LogicalType::LIST(LogicalType::DOUBLE)}};
 	vector<std::pair<string, LogicalType>> param_names_unary = {{"x", LogicalType::DOUBLE}};
 
 	auto make_unary = [](auto func) {
 		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
-			DistributionCallBinaryUnary<DISTRIBUTION, double>(args, state, result, func);
+			if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+				DistributionCallUnary<FAST_DISTRIBUTION, double>(args, state, result, func);
+			} else {
+				DistributionCallUnary<DISTRIBUTION, double>(args, state, result, func);
+			}
+		};
+	};
+
+	// With stochastic_precision 'fast' the functions of the cdf evaluate the incomplete beta function a
+	// chunk at a time; full precision keeps boost::math.
+	auto make_cdf = [](CdfFunction function, auto func) {
+		return [function, func](DataChunk &args, ExpressionState &state, Vector &result) {
+			if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+				DistributionCallCdfKernel<FAST_DISTRIBUTION, CDF_KERNEL>(args, state, result, function, func);
+			} else {
+				DistributionCallUnary<DISTRIBUTION, double>(args, state, result, func);
+			}
+		};
+	};
+
+	auto make_list = [](auto func) {
+		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
+			if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+				DistributionCallList<FAST_DISTRIBUTION>(args, state, result, func);
+			} else {
+				DistributionCallList<DISTRIBUTION>(args, state, result, func);
+			}
 		};
 	};
 
 	auto make_none = [](auto func) {
 		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
-			DistributionCallBinaryNone<DISTRIBUTION>(args, state, result,
-			                                         [func](Vector &result, const auto &dist) { return func(dist); });
+			DistributionCallNone<DISTRIBUTION>(args, state, result,
+			                                   [func](Vector &result, const auto &dist) { return func(dist); });
 		};
 	};
 
 	REGISTER(
 	    loader, "sample", FunctionStability::VOLATILE, LogicalType::DOUBLE,
 	    [](DataChunk &args, ExpressionState &state, Vector &result) {
-		    DistributionSampleBinary<SAMPLE_DISTRIBUTION, double>(args, state, result);
+		    DistributionSampleBatch<SAMPLE_DISTRIBUTION, double>(args, state, result);
 	    },
 	    "Generates random samples from the " + DISTRIBUTION_TEXT + " with specified parameters.", "sample(2.0, 5.0)");
 
@@ -90,32 +144,36 @@ LOAD_DISTRIBUTION_FN {
 
 	// === CUMULATIVE DISTRIBUTION FUNCTIONS ===
 	REGISTER(loader, "cdf", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
-	         make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::cdf(dist, x); }),
+	         make_cdf(CdfFunction::CDF,
+	                  [](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::cdf(dist, x); }),
 	         "Computes the cumulative distribution function (CDF) of the " + DISTRIBUTION_TEXT +
 	             ". Returns the "
 	             "probability that a random variable X is less than or equal to x.",
 	         "cdf(2.0, 5.0, 0.5)", param_names_unary);
 
 	REGISTER(loader, "cdf_complement", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
-	         make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type {
-		         return boost::math::cdf(boost::math::complement(dist, x));
-	         }),
+	         make_cdf(CdfFunction::CDF_COMPLEMENT,
+	                  [](const auto &dist, auto x) -> DISTRIBUTION::value_type {
+		                  return boost::math::cdf(boost::math::complement(dist, x));
+	                  }),
 	         "Computes the complementary cumulative distribution function (1 - CDF) of the " + DISTRIBUTION_TEXT +
 	             ". Returns the probability that X > x, equivalent to the survival function.",
 	         "cdf_complement(2.0, 5.0, 0.5)", param_names_unary);
 
 	REGISTER(
 	    loader, "log_cdf", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
-	    make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::logcdf(dist, x); }),
+	    make_cdf(CdfFunction::LOG_CDF,
+	             [](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::logcdf(dist, x); }),
 	    "Computes the natural logarithm of the cumulative distribution function (CDF) of the " + DISTRIBUTION_TEXT +
 	        ". "
 	        "Returns the logarithm of the probability that a random variable X is less than or equal to x.",
 	    "log_cdf(2.0, 5.0, 0.5)", param_names_unary);
 
 	REGISTER(loader, "log_cdf_complement", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
-	         make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type {
-		         return boost::math::logcdf(boost::math::complement(dist, x));
-	         }),
+	         make_cdf(CdfFunction::LOG_CDF_COMPLEMENT,
+	                  [](const auto &dist, auto x) -> DISTRIBUTION::value_type {
+		                  return boost::math::logcdf(boost::math::complement(dist, x));
+	                  }),
 	         "Computes the natural logarithm of the complementary cumulative distribution function (1 - CDF) of the " +
 	             DISTRIBUTION_TEXT +
 	             ". Returns the logarithm of the probability that X > x, equivalent to the survival function.",
@@ -139,6 +197,13 @@ LOAD_DISTRIBUTION_FN {
 	             "such that P(X > x) = p, useful for computing upper tail quantiles.",
 	         "quantile_complement(2.0, 5.0, 0.05)", param_names_quantile);
 
+	REGISTER(
+	    loader, "quantiles", FunctionStability::CONSISTENT, LogicalType::LIST(LogicalType::DOUBLE),
+	    make_list([](const auto &dist, auto p) -> DISTRIBUTION::value_type { return boost::math::quantile(dist, p); }),
+	    "Computes the quantile function of the " + DISTRIBUTION_TEXT +
+	        " at every probability of a list, building the distribution once for the row.",
+	    "quantiles(2.0, 5.0, [0.05, 0.5, 0.95])", param_names_quantiles);
+
 	REGISTER(
 	    loader, "hazard", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
 	    make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::hazard(dist, x); }),
@@ -149,8 +214,29 @@ LOAD_DISTRIBUTION_FN {
 	         "Computes the cumulative hazard function of the " + DISTRIBUTION_TEXT + ".", "chf(2.0, 5.0, 0.5)",
 	         param_names_unary);
 
+	REGISTER(
+	    loader, "eval", FunctionStability::CONSISTENT, DistributionEvalType(),
+	    [](DataChunk &args, ExpressionState &state, Vector &result) {
+		    if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+			    DistributionCallEval<FAST_DISTRIBUTION, double>(args, state, result);
+		    } else {
+			    DistributionCallEval<DISTRIBUTION, double>(args, state, result);
+		    }
+	    },
+	    "Evaluates the PDF, log-PDF, CDF, survival function and hazard of the " + DISTRIBUTION_TEXT +
+	        " at x as one struct, computing the PDF and survival function once for all of them.",
+	    "eval(2.0, 5.0, 0.5)", param_names_unary);
+
 	// === DISTRIBUTION PROPERTIES ===
 
+	REGISTER(loader, "summary", FunctionStability::CONSISTENT, DistributionSummaryType(),
+	         [](DataChunk &args, ExpressionState &state, Vector &result) {
+		         DistributionCallSummary<DISTRIBUTION>(args, state, result);
+	         },
+	         "Returns the mean, variance, standard deviation, skewness, kurtosis, median and mode of the " +
+	             DISTRIBUTION_TEXT + " as one struct. Moments that are undefined for the parameters are NULL.",
+	         "summary(2.0, 5.0)");
+
 	REGISTER(loader, "mean", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
 	         make_none([](const auto &dist) { return boost::math::mean(dist); }),
 	         "Returns the mean (μ) of the " + DISTRIBUTION_TEXT + ", which is the first moment.", "mean(2.0, 5.0)");
@@ -192,5 +278,12 @@ LOAD_DISTRIBUTION_FN {
 	REGISTER(loader, "support", FunctionStability::CONSISTENT, LogicalType::ARRAY(LogicalType::DOUBLE, 2),
 	         make_none([](const auto &dist) { return boost::math::support(dist); }),
 	         "Returns the support of the " + DISTRIBUTION_TEXT + ".", "support(2.0, 5.0)");
+
+	// === DISTRIBUTION VALUE ===
+	RegisterDistributionConstructor<DISTRIBUTION>(loader, DISTRIBUTION_TEXT, "2.0, 5.0");
+
+	// === SINGLE PRECISION OVERLOADS ===
+	RegisterFloatOverloads<FLOAT_DISTRIBUTION, FLOAT_SAMPLE_DISTRIBUTION>(loader, DISTRIBUTION_TEXT,
+	                                                                      "2.0::FLOAT, 5.0::FLOAT", "0.5::FLOAT");
 }
 } // end namespace duckdb
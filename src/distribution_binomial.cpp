@@ -1,6 +1,7 @@
 #include "utils.hpp"
 #include "rng_utils.hpp"
 #include "distribution_traits.hpp"
+#include "pmf_recurrence.hpp"
 
 namespace duckdb {
 
@@ -8,7 +9,7 @@ namespace duckdb {
 #define DISTRIBUTION_TEXT       string(string(DISTRIBUTION_SHORT_NAME) + " distribution")
 #define DISTRIBUTION_NAME       binomial_distribution
 #define DISTRIBUTION            boost::math::DISTRIBUTION_NAME<double>
-#define SAMPLE_DISTRIBUTION     boost::random::DISTRIBUTION_NAME<int64_t>
+#define SAMPLE_DISTRIBUTION     binomial_sampler<int64_t>
 #define REGISTER                RegisterFunction<DISTRIBUTION>
 
 template <typename DistType>
@@ -24,6 +25,10 @@ struct distribution_traits_base {
 		return {logical_type_map<param1_t>::Get(), logical_type_map<param2_t>::Get()};
 	}
 
+	static bool ParametersValid(param1_t trials, param2_t prob) {
+		return (trials > 0) & (prob >= 0) & (prob <= 1);
+	}
+
 	static void ValidateParameters(param1_t trials, param2_t prob) {
 		if (trials <= 0) {
 			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) +
@@ -43,6 +48,17 @@ struct distribution_traits_base {
 DEFINE_DIST_TRAITS(DISTRIBUTION);
 DEFINE_DIST_TRAITS(SAMPLE_DISTRIBUTION);
 
+// Reduced precision instantiation used when stochastic_precision is 'fast'
+#define FAST_DISTRIBUTION boost::math::DISTRIBUTION_NAME<double, fast_precision_policy>
+DEFINE_DIST_TRAITS(FAST_DISTRIBUTION);
+
+template <>
+struct pmf_recurrence<DISTRIBUTION> {
+	static double Ratio(const DISTRIBUTION &dist, double k) {
+		return (dist.trials() - k) / (k + 1) * (dist.success_fraction() / (1 - dist.success_fraction()));
+	}
+};
+
 #define CONCAT(a, b)            a##b
 #define EXPAND_AND_CONCAT(a, b) CONCAT(a, b)
 
@@ -50,25 +66,41 @@ DEFINE_DIST_TRAITS(SAMPLE_DISTRIBUTION);
 
 LOAD_DISTRIBUTION_FN {
 	vector<std::pair<string, LogicalType>> param_names_quantile = {{"p", LogicalType::DOUBLE}};
+	vector<std::pair<string, LogicalType>> param_names_quantiles = {{"p", LogicalType::LIST(LogicalType::DOUBLE)}};
 	vector<std::pair<string, LogicalType>> param_names_unary = {{"x", LogicalType::DOUBLE}};
+	vector<std::pair<string, LogicalType>> param_names_kmax = {{"kmax", LogicalType::BIGINT}};
 
 	auto make_unary = [](auto func) {
 		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
-			DistributionCallBinaryUnary<DISTRIBUTION, double>(args, state, result, func);
+			if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+				DistributionCallUnary<FAST_DISTRIBUTION, double>(args, state, result, func);
+			} else {
+				DistributionCallUnary<DISTRIBUTION, double>(args, state, result, func);
+			}
+		};
+	};
+
+	auto make_list = [](auto func) {
+		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
+			if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+				DistributionCallList<FAST_DISTRIBUTION>(args, state, result, func);
+			} else {
+				DistributionCallList<DISTRIBUTION>(args, state, result, func);
+			}
 		};
 	};
 
 	auto make_none = [](auto func) {
 		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
-			DistributionCallBinaryNone<DISTRIBUTION>(args, state, result,
-			                                         [func](Vector &result, const auto &dist) { return func(dist); });
+			DistributionCallNone<DISTRIBUTION>(args, state, result,
+			                                   [func](Vector &result, const auto &dist) { return func(dist); });
 		};
 	};
 
 	REGISTER(
 	    loader, "sample", FunctionStability::VOLATILE, LogicalType::BIGINT,
 	    [](DataChunk &args, ExpressionState &state, Vector &result) {
-		    DistributionSampleBinary<SAMPLE_DISTRIBUTION, int64_t>(args, state, result);
+		    DistributionSampleBatch<SAMPLE_DISTRIBUTION, int64_t>(args, state, result);
 	    },
 	    "Generates random samples from the " + DISTRIBUTION_TEXT + " with specified parameters.", "sample(10, 0.5)");
 
@@ -87,9 +119,26 @@ LOAD_DISTRIBUTION_FN {
 	        ". Useful for numerical stability when dealing with very small probabilities.",
 	    "log_pdf(10, 0.5, 5)", param_names_unary);
 
+	REGISTER(
+	    loader, "pmf_range", FunctionStability::CONSISTENT, LogicalType::LIST(LogicalType::DOUBLE),
+	    [](DataChunk &args, ExpressionState &state, Vector &result) {
+		    DistributionCallPmfRange<DISTRIBUTION>(args, state, result);
+	    },
+	    "Computes the probability mass function of the " + DISTRIBUTION_TEXT +
+	        " at 0, 1, ..., kmax and returns it as a list. The values are computed by recurrence from the mode.",
+	    "pmf_range(10, 0.5, 10)", param_names_kmax);
+
 	// === CUMULATIVE DISTRIBUTION FUNCTIONS ===
+	// Chunks with constant parameters and ascending integer x are evaluated by recurrence.
+	auto cdf_boost =
+	    make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::cdf(dist, x); });
+
 	REGISTER(loader, "cdf", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
-	         make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::cdf(dist, x); }),
+	         [cdf_boost](DataChunk &args, ExpressionState &state, Vector &result) {
+		         if (!DiscreteCdfRange<DISTRIBUTION>(args, state, result)) {
+			         cdf_boost(args, state, result);
+		         }
+	         },
 	         "Computes the cumulative distribution function (CDF) of the " + DISTRIBUTION_TEXT +
 	             ". Returns the "
 	             "probability that a random variable X is less than or equal to x.",
@@ -138,6 +187,13 @@ LOAD_DISTRIBUTION_FN {
 	             "such that P(X > x) = p, useful for computing upper tail quantiles.",
 	         "quantile_complement(10, 0.5, 0.05)", param_names_quantile);
 
+	REGISTER(
+	    loader, "quantiles", FunctionStability::CONSISTENT, LogicalType::LIST(LogicalType::BIGINT),
+	    make_list([](const auto &dist, auto p) -> DISTRIBUTION::value_type { return boost::math::quantile(dist, p); }),
+	    "Computes the quantile function of the " + DISTRIBUTION_TEXT +
+	        " at every probability of a list, building the distribution once for the row.",
+	    "quantiles(10, 0.5, [0.05, 0.5, 0.95])", param_names_quantiles);
+
 	REGISTER(
 	    loader, "hazard", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
 	    make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::hazard(dist, x); }),
@@ -148,8 +204,29 @@ LOAD_DISTRIBUTION_FN {
 	         "Computes the cumulative hazard function of the " + DISTRIBUTION_TEXT + ".", "chf(10, 0.5, 5)",
 	         param_names_unary);
 
+	REGISTER(
+	    loader, "eval", FunctionStability::CONSISTENT, DistributionEvalType(),
+	    [](DataChunk &args, ExpressionState &state, Vector &result) {
+		    if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+			    DistributionCallEval<FAST_DISTRIBUTION, double>(args, state, result);
+		    } else {
+			    DistributionCallEval<DISTRIBUTION, double>(args, state, result);
+		    }
+	    },
+	    "Evaluates the PDF, log-PDF, CDF, survival function and hazard of the " + DISTRIBUTION_TEXT +
+	        " at x as one struct, computing the PDF and survival function once for all of them.",
+	    "eval(10, 0.5, 5)", param_names_unary);
+
 	// === DISTRIBUTION PROPERTIES ===
 
+	REGISTER(loader, "summary", FunctionStability::CONSISTENT, DistributionSummaryType(),
+	         [](DataChunk &args, ExpressionState &state, Vector &result) {
+		         DistributionCallSummary<DISTRIBUTION>(args, state, result);
+	         },
+	         "Returns the mean, variance, standard deviation, skewness, kurtosis, median and mode of the " +
+	             DISTRIBUTION_TEXT + " as one struct. Moments that are undefined for the parameters are NULL.",
+	         "summary(10, 0.5)");
+
 	// REGISTER(loader, "mean", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
 	//          make_none([](const auto &dist) { return dist.mean(); }),
 	//          "Returns the mean (μ) of the " + DISTRIBUTION_TEXT + ", which is the first moment.", "mean(0.0, 1.0)");
@@ -191,5 +268,8 @@ LOAD_DISTRIBUTION_FN {
 	REGISTER(loader, "support", FunctionStability::CONSISTENT, LogicalType::ARRAY(LogicalType::DOUBLE, 2),
 	         make_none([](const auto &dist) { return boost::math::support(dist); }),
 	         "Returns the support of the " + DISTRIBUTION_TEXT + ".", "support(10, 0.5)");
+
+	// === DISTRIBUTION VALUE ===
+	RegisterDistributionConstructor<DISTRIBUTION>(loader, DISTRIBUTION_TEXT, "10, 0.5");
 }
 } // end namespace duckdb
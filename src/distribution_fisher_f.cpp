@@ -8,7 +8,8 @@ namespace duckdb {
 #define DISTRIBUTION_TEXT       string(string(DISTRIBUTION_SHORT_NAME) + " distribution")
 #define DISTRIBUTION_NAME       fisher_f_distribution
 #define DISTRIBUTION            boost::math::DISTRIBUTION_NAME<double>
-#define SAMPLE_DISTRIBUTION     boost::random::DISTRIBUTION_NAME<double>
+#define SAMPLE_DISTRIBUTION     fisher_f_sampler<double>
+#define CDF_KERNEL              fisher_f_cdf_kernel
 #define REGISTER                RegisterFunction<DISTRIBUTION>
 
 template <typename DistType>
@@ -24,6 +25,10 @@ struct distribution_traits_base {
 		return {logical_type_map<param1_t>::Get(), logical_type_map<param2_t>::Get()};
 	}
 
+	static bool ParametersValid(param1_t d1, param2_t d2) {
+		return (d1 > 0) & (d2 > 0) & std::isfinite(d1) & std::isfinite(d2);
+	}
+
 	static void ValidateParameters(param1_t d1, param2_t d2) {
 		if (d1 <= 0) {
 			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) +
@@ -33,6 +38,14 @@ struct distribution_traits_base {
 			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) +
 			                            ": d2 must be > 0 was: " + std::to_string(d2));
 		}
+		if (std::isinf(d1)) {
+			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) +
+			                            ": d1 must be finite was: " + std::to_string(d1));
+		}
+		if (std::isinf(d2)) {
+			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) +
+			                            ": d2 must be finite was: " + std::to_string(d2));
+		}
 	}
 };
 
@@ -43,6 +56,20 @@ struct distribution_traits_base {
 DEFINE_DIST_TRAITS(DISTRIBUTION);
 DEFINE_DIST_TRAITS(SAMPLE_DISTRIBUTION);
 
+// Reduced precision instantiation used when stochastic_precision is 'fast'
+#define FAST_DISTRIBUTION boost::math::DISTRIBUTION_NAME<double, fast_precision_policy>
+DEFINE_DIST_TRAITS(FAST_DISTRIBUTION);
+
+// Single precision instantiations backing the FLOAT overloads
+#define FLOAT_DISTRIBUTION        boost::math::DISTRIBUTION_NAME<float>
+#define FLOAT_SAMPLE_DISTRIBUTION fisher_f_sampler<float>
+#define DEFINE_FLOAT_DIST_TRAITS(DIST)                                                                                 \
+	template <>                                                                                                        \
+	struct distribution_traits<DIST> : public real_distribution_traits<distribution_traits_base<DIST>, float> {};
+
+DEFINE_FLOAT_DIST_TRAITS(FLOAT_DISTRIBUTION);
+DEFINE_FLOAT_DIST_TRAITS(FLOAT_SAMPLE_DISTRIBUTION);
+
 #define CONCAT(a, b)            a##b
 #define EXPAND_AND_CONCAT(a, b) CONCAT(a, b)
 
@@ -50,25 +77,52 @@ DEFINE_DIST_TRAITS(SAMPLE_DISTRIBUTION);
 
 LOAD_DISTRIBUTION_FN {
 	vector<std::pair<string, LogicalType>> param_names_quantile = {{"p", LogicalType::DOUBLE}};
+	vector<std::pair<string, LogicalType>> param_names_quantiles = {{"p", LogicalType::LIST(LogicalType::DOUBLE)}};
 	vector<std::pair<string, LogicalType>> param_names_unary = {{"x", LogicalType::DOUBLE}};
 
 	auto make_unary = [](auto func) {
 		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
-			DistributionCallBinaryUnary<DISTRIBUTION, double>(args, state, result, func);
+			if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+				DistributionCallUnary<FAST_DISTRIBUTION, double>(args, state, result, func);
+			} else {
+				DistributionCallUnary<DISTRIBUTION, double>(args, state, result, func);
+			}
+		};
+	};
+
+	// With stochastic_precision 'fast' the functions of the cdf evaluate the incomplete beta function a
+	// chunk at a time; full precision keeps boost::math.
+	auto make_cdf = [](CdfFunction function, auto func) {
+		return [function, func](DataChunk &args, ExpressionState &state, Vector &result) {
+			if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+				DistributionCallCdfKernel<FAST_DISTRIBUTION, CDF_KERNEL>(args, state, result, function, func);
+			} else {
+				DistributionCallUnary<DISTRIBUTION, double>(args, state, result, func);
+			}
+		};
+	};
+
+	auto make_list = [](auto func) {
+		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
+			if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+				DistributionCallList<FAST_DISTRIBUTION>(args, state, result, func);
+			} else {
+				DistributionCallList<DISTRIBUTION>(args, state, result, func);
+			}
 		};
 	};
 
 	auto make_none = [](auto func) {
 		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
-			DistributionCallBinaryNone<DISTRIBUTION>(args, state, result,
-			                                         [func](Vector &result, const auto &dist) { return func(dist); });
+			DistributionCallNone<DISTRIBUTION>(args, state, result,
+			                                   [func](Vector &result, const auto &dist) { return func(dist); });
 		};
 	};
 
 	REGISTER(
 	    loader, "sample", FunctionStability::VOLATILE, LogicalType::DOUBLE,
 	    [](DataChunk &args, ExpressionState &state, Vector &result) {
-		    DistributionSampleBinary<SAMPLE_DISTRIBUTION, double>(args, state, result);
+		    DistributionSampleBatch<SAMPLE_DISTRIBUTION, double>(args, state, result);
 	    },
 	    "Generates random samples from the " + DISTRIBUTION_TEXT + " with specified parameters.", "sample(5, 10)");
 
@@ -89,32 +143,36 @@ LOAD_DISTRIBUTION_FN {
 
 	// === CUMULATIVE DISTRIBUTION FUNCTIONS ===
 	REGISTER(loader, "cdf", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
-	         make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::cdf(dist, x); }),
+	         make_cdf(CdfFunction::CDF,
+	                  [](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::cdf(dist, x); }),
 	         "Computes the cumulative distribution function (CDF) of the " + DISTRIBUTION_TEXT +
 	             ". Returns the "
 	             "probability that a random variable X is less than or equal to x.",
 	         "cdf(5, 10, 0.5)", param_names_unary);
 
 	REGISTER(loader, "cdf_complement", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
-	         make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type {
-		         return boost::math::cdf(boost::math::complement(dist, x));
-	         }),
+	         make_cdf(CdfFunction::CDF_COMPLEMENT,
+	                  [](const auto &dist, auto x) -> DISTRIBUTION::value_type {
+		                  return boost::math::cdf(boost::math::complement(dist, x));
+	                  }),
 	         "Computes the complementary cumulative distribution function (1 - CDF) of the " + DISTRIBUTION_TEXT +
 	             ". Returns the probability that X > x, equivalent to the survival function.",
 	         "cdf_complement(5, 10, 0.5)", param_names_unary);
 
 	REGISTER(
 	    loader, "log_cdf", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
-	    make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::logcdf(dist, x); }),
+	    make_cdf(CdfFunction::LOG_CDF,
+	             [](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::logcdf(dist, x); }),
 	    "Computes the natural logarithm of the cumulative distribution function (CDF) of the " + DISTRIBUTION_TEXT +
 	        ". "
 	        "Returns the logarithm of the probability that a random variable X is less than or equal to x.",
 	    "log_cdf(5, 10, 0.5)", param_names_unary);
 
 	REGISTER(loader, "log_cdf_complement", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
-	         make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type {
-		         return boost::math::logcdf(boost::math::complement(dist, x));
-	         }),
+	         make_cdf(CdfFunction::LOG_CDF_COMPLEMENT,
+	                  [](const auto &dist, auto x) -> DISTRIBUTION::value_type {
+		                  return boost::math::logcdf(boost::math::complement(dist, x));
+	                  }),
 	         "Computes the natural logarithm of the complementary cumulative distribution function (1 - CDF) of the " +
 	             DISTRIBUTION_TEXT +
 	             ". Returns the logarithm of the probability that X > x, equivalent to the survival function.",
@@ -138,6 +196,13 @@ LOAD_DISTRIBUTION_FN {
 	             "such that P(X > x) = p, useful for computing upper tail quantiles.",
 	         "quantile_complement(5, 10, 0.05)", param_names_quantile);
 
+	REGISTER(
+	    loader, "quantiles", FunctionStability::CONSISTENT, LogicalType::LIST(LogicalType::DOUBLE),
+	    make_list([](const auto &dist, auto p) -> DISTRIBUTION::value_type { return boost::math::quantile(dist, p); }),
+	    "Computes the quantile function of the " + DISTRIBUTION_TEXT +
+	        " at every probability of a list, building the distribution once for the row.",
+	    "quantiles(5, 10, [0.05, 0.5, 0.95])", param_names_quantiles);
+
 	REGISTER(
 	    loader, "hazard", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
 	    make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::hazard(dist, x); }),
@@ -148,8 +213,29 @@ LOAD_DISTRIBUTION_FN {
 	         "Computes the cumulative hazard function of the " + DISTRIBUTION_TEXT + ".", "chf(5, 10, 0.5)",
 	         param_names_unary);
 
+	REGISTER(
+	    loader, "eval", FunctionStability::CONSISTENT, DistributionEvalType(),
+	    [](DataChunk &args, ExpressionState &state, Vector &result) {
+		    if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+			    DistributionCallEval<FAST_DISTRIBUTION, double>(args, state, result);
+		    } else {
+			    DistributionCallEval<DISTRIBUTION, double>(args, state, result);
+		    }
+	    },
+	    "Evaluates the PDF, log-PDF, CDF, survival function and hazard of the " + DISTRIBUTION_TEXT +
+	        " at x as one struct, computing the PDF and survival function once for all of them.",
+	    "eval(5, 10, 0.5)", param_names_unary);
+
 	// === DISTRIBUTION PROPERTIES ===
 
+	REGISTER(loader, "summary", FunctionStability::CONSISTENT, DistributionSummaryType(),
+	         [](DataChunk &args, ExpressionState &state, Vector &result) {
+		         DistributionCallSummary<DISTRIBUTION>(args, state, result);
+	         },
+	         "Returns the mean, variance, standard deviation, skewness, kurtosis, median and mode of the " +
+	             DISTRIBUTION_TEXT + " as one struct. Moments that are undefined for the parameters are NULL.",
+	         "summary(5, 10)");
+
 	// REGISTER(loader, "mean", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
 	//          make_none([](const auto &dist) { return dist.mean(); }),
 	//          "Returns the mean (μ) of the " + DISTRIBUTION_TEXT + ", which is the first moment.", "mean(0.0, 1.0)");
@@ -191,5 +277,12 @@ LOAD_DISTRIBUTION_FN {
 	REGISTER(loader, "support", FunctionStability::CONSISTENT, LogicalType::ARRAY(LogicalType::DOUBLE, 2),
 	         make_none([](const auto &dist) { return boost::math::support(dist); }),
 	         "Returns the support of the " + DISTRIBUTION_TEXT + ".", "support(5, 10)");
+
+	// === DISTRIBUTION VALUE ===
+	RegisterDistributionConstructor<DISTRIBUTION>(loader, DISTRIBUTION_TEXT, "5, 10");
+
+	// === SINGLE PRECISION OVERLOADS ===
+	RegisterFloatOverloads<FLOAT_DISTRIBUTION, FLOAT_SAMPLE_DISTRIBUTION>(loader, DISTRIBUTION_TEXT,
+	                                                                      "5.0::FLOAT, 2.0::FLOAT", "0.5::FLOAT");
 }
 } // end namespace duckdb
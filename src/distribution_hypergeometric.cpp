@@ -0,0 +1,279 @@
+#include "utils.hpp"
+#include "rng_utils.hpp"
+#include "distribution_traits.hpp"
+#include "pmf_recurrence.hpp"
+#include "hypergeometric_moments.hpp"
+
+namespace duckdb {
+
+#define DISTRIBUTION_SHORT_NAME "hypergeometric"
+#define DISTRIBUTION_TEXT       string(string(DISTRIBUTION_SHORT_NAME) + " distribution")
+#define DISTRIBUTION_NAME       hypergeometric_distribution
+#define DISTRIBUTION            boost::math::DISTRIBUTION_NAME<double>
+#define SAMPLE_DISTRIBUTION     hypergeometric_sampler<int64_t>
+#define REGISTER                RegisterFunction<DISTRIBUTION>
+
+template <typename DistType>
+struct distribution_traits_base {
+	using param1_t = int64_t;
+	using param2_t = int64_t;
+	using param3_t = int64_t;
+	using return_t = double;
+
+	static constexpr std::array<const char *, 3> param_names = {"defective", "sample_count", "total"};
+	static constexpr const char *prefix = DISTRIBUTION_SHORT_NAME;
+
+	// boost::math keeps the counts as unsigned and forms sample_count + defective - total as int,
+	// which stays exact while the total is below 2^30.
+	static constexpr int64_t MAX_TOTAL = (int64_t(1) << 30) - 1;
+
+	static std::vector<LogicalType> LogicalParamTypes() {
+		return {logical_type_map<param1_t>::Get(), logical_type_map<param2_t>::Get(),
+		        logical_type_map<param3_t>::Get()};
+	}
+
+	static bool ParametersValid(param1_t defective, param2_t sample_count, param3_t total) {
+		return (total >= 0) & (total <= MAX_TOTAL) & (defective >= 0) & (defective <= total) & (sample_count >= 0) &
+		       (sample_count <= total);
+	}
+
+	static void ValidateParameters(param1_t defective, param2_t sample_count, param3_t total) {
+		if (total < 0 || total > MAX_TOTAL) {
+			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) + ": Total must be in [0, " +
+			                            std::to_string(MAX_TOTAL) + "] was: " + std::to_string(total));
+		}
+		if (defective < 0 || defective > total) {
+			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) +
+			                            ": Number of defective items must be in [0, total] was: " +
+			                            std::to_string(defective));
+		}
+		if (sample_count < 0 || sample_count > total) {
+			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) +
+			                            ": Sample count must be in [0, total] was: " + std::to_string(sample_count));
+		}
+	}
+};
+
+#define DEFINE_DIST_TRAITS(DIST)                                                                                       \
+	template <>                                                                                                        \
+	struct distribution_traits<DIST> : public distribution_traits_base<DIST> {};
+
+DEFINE_DIST_TRAITS(DISTRIBUTION);
+DEFINE_DIST_TRAITS(SAMPLE_DISTRIBUTION);
+
+template <>
+struct pmf_recurrence<DISTRIBUTION> {
+	static double Ratio(const DISTRIBUTION &dist, double k) {
+		const double r = dist.defective();
+		const double n = dist.sample_count();
+		return (r - k) * (n - k) / ((k + 1) * (double(dist.total()) - r - n + k + 1));
+	}
+};
+
+#define CONCAT(a, b)            a##b
+#define EXPAND_AND_CONCAT(a, b) CONCAT(a, b)
+
+#define LOAD_DISTRIBUTION_FN void EXPAND_AND_CONCAT(Load_, DISTRIBUTION_NAME)(ExtensionLoader & loader)
+
+LOAD_DISTRIBUTION_FN {
+	vector<std::pair<string, LogicalType>> param_names_quantile = {{"p", LogicalType::DOUBLE}};
+	vector<std::pair<string, LogicalType>> param_names_quantiles = {{"p", LogicalType::LIST(LogicalType::DOUBLE)}};
+	vector<std::pair<string, LogicalType>> param_names_unary = {{"x", LogicalType::DOUBLE}};
+	vector<std::pair<string, LogicalType>> param_names_kmax = {{"kmax", LogicalType::BIGINT}};
+
+	auto make_unary = [](auto func) {
+		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
+			DistributionCallUnary<DISTRIBUTION, double>(args, state, result, func);
+		};
+	};
+
+	auto make_list = [](auto func) {
+		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
+			DistributionCallList<DISTRIBUTION>(args, state, result, func);
+		};
+	};
+
+	auto make_none = [](auto func) {
+		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
+			DistributionCallNone<DISTRIBUTION>(args, state, result,
+			                                   [func](Vector &result, const auto &dist) { return func(dist); });
+		};
+	};
+
+	REGISTER(
+	    loader, "sample", FunctionStability::VOLATILE, LogicalType::BIGINT,
+	    [](DataChunk &args, ExpressionState &state, Vector &result) {
+		    DistributionSampleBatch<SAMPLE_DISTRIBUTION, int64_t>(args, state, result);
+	    },
+	    "Generates random samples from the " + DISTRIBUTION_TEXT + " with specified parameters.", "sample(10, 5, 50)");
+
+	REGISTER(loader, "pdf", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::pdf(dist, x); }),
+	         "Computes the probability density function (PDF) of the " + DISTRIBUTION_TEXT +
+	             ". Returns the probability density"
+	             "at point x for a " +
+	             DISTRIBUTION_TEXT + " with specified parameters.",
+	         "pdf(10, 5, 50, 1)", param_names_unary);
+
+	REGISTER(
+	    loader, "log_pdf", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	    make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::logpdf(dist, x); }),
+	    "Computes the natural logarithm of the probability density function (log-PDF) of the " + DISTRIBUTION_TEXT +
+	        ". Useful for numerical stability when dealing with very small probabilities.",
+	    "log_pdf(10, 5, 50, 1)", param_names_unary);
+
+	REGISTER(
+	    loader, "pmf_range", FunctionStability::CONSISTENT, LogicalType::LIST(LogicalType::DOUBLE),
+	    [](DataChunk &args, ExpressionState &state, Vector &result) {
+		    DistributionCallPmfRange<DISTRIBUTION>(args, state, result);
+	    },
+	    "Computes the probability mass function of the " + DISTRIBUTION_TEXT +
+	        " at 0, 1, ..., kmax and returns it as a list. The values are computed by recurrence from the mode.",
+	    "pmf_range(10, 5, 50, 5)", param_names_kmax);
+
+	// === CUMULATIVE DISTRIBUTION FUNCTIONS ===
+	// Chunks with constant parameters and ascending integer x are evaluated by recurrence.
+	auto cdf_boost =
+	    make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::cdf(dist, x); });
+
+	REGISTER(loader, "cdf", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         [cdf_boost](DataChunk &args, ExpressionState &state, Vector &result) {
+		         if (!DiscreteCdfRange<DISTRIBUTION>(args, state, result)) {
+			         cdf_boost(args, state, result);
+		         }
+	         },
+	         "Computes the cumulative distribution function (CDF) of the " + DISTRIBUTION_TEXT +
+	             ". Returns the "
+	             "probability that a random variable X is less than or equal to x.",
+	         "cdf(10, 5, 50, 1)", param_names_unary);
+
+	REGISTER(loader, "cdf_complement", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type {
+		         return boost::math::cdf(boost::math::complement(dist, x));
+	         }),
+	         "Computes the complementary cumulative distribution function (1 - CDF) of the " + DISTRIBUTION_TEXT +
+	             ". Returns the probability that X > x, equivalent to the survival function.",
+	         "cdf_complement(10, 5, 50, 1)", param_names_unary);
+
+	REGISTER(
+	    loader, "log_cdf", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	    make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::logcdf(dist, x); }),
+	    "Computes the natural logarithm of the cumulative distribution function (CDF) of the " + DISTRIBUTION_TEXT +
+	        ". "
+	        "Returns the logarithm of the probability that a random variable X is less than or equal to x.",
+	    "log_cdf(10, 5, 50, 1)", param_names_unary);
+
+	REGISTER(loader, "log_cdf_complement", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type {
+		         return boost::math::logcdf(boost::math::complement(dist, x));
+	         }),
+	         "Computes the natural logarithm of the complementary cumulative distribution function (1 - CDF) of the " +
+	             DISTRIBUTION_TEXT +
+	             ". Returns the logarithm of the probability that X > x, equivalent to the survival function.",
+	         "log_cdf_complement(10, 5, 50, 1)", param_names_unary);
+
+	// === QUANTILE FUNCTIONS ===
+	REGISTER(
+	    loader, "quantile", FunctionStability::CONSISTENT, LogicalType::BIGINT,
+	    make_unary([](const auto &dist, auto p) -> DISTRIBUTION::value_type { return boost::math::quantile(dist, p); }),
+	    "Computes the quantile function (inverse CDF) of the " + DISTRIBUTION_TEXT +
+	        ". Returns the value x "
+	        "such that P(X ≤ x) = p, where p is the cumulative probability.",
+	    "quantile(10, 5, 50, 0.95)", param_names_quantile);
+
+	REGISTER(loader, "quantile_complement", FunctionStability::CONSISTENT, LogicalType::BIGINT,
+	         make_unary([](const auto &dist, auto p) -> DISTRIBUTION::value_type {
+		         return boost::math::quantile(boost::math::complement(dist, p));
+	         }),
+	         "Computes the complementary quantile function of the " + DISTRIBUTION_TEXT +
+	             ". Returns the value x "
+	             "such that P(X > x) = p, useful for computing upper tail quantiles.",
+	         "quantile_complement(10, 5, 50, 0.05)", param_names_quantile);
+
+	REGISTER(
+	    loader, "quantiles", FunctionStability::CONSISTENT, LogicalType::LIST(LogicalType::BIGINT),
+	    make_list([](const auto &dist, auto p) -> DISTRIBUTION::value_type { return boost::math::quantile(dist, p); }),
+	    "Computes the quantile function of the " + DISTRIBUTION_TEXT +
+	        " at every probability of a list, building the distribution once for the row.",
+	    "quantiles(10, 5, 50, [0.05, 0.5, 0.95])", param_names_quantiles);
+
+	REGISTER(
+	    loader, "hazard", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	    make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::hazard(dist, x); }),
+	    "Computes the hazard function of the " + DISTRIBUTION_TEXT + ".", "hazard(10, 5, 50, 1)", param_names_unary);
+
+	REGISTER(loader, "chf", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::chf(dist, x); }),
+	         "Computes the cumulative hazard function of the " + DISTRIBUTION_TEXT + ".", "chf(10, 5, 50, 1)",
+	         param_names_unary);
+
+	REGISTER(
+	    loader, "eval", FunctionStability::CONSISTENT, DistributionEvalType(),
+	    [](DataChunk &args, ExpressionState &state, Vector &result) {
+		    DistributionCallEval<DISTRIBUTION, double>(args, state, result);
+	    },
+	    "Evaluates the PDF, log-PDF, CDF, survival function and hazard of the " + DISTRIBUTION_TEXT +
+	        " at x as one struct, computing the PDF and survival function once for all of them.",
+	    "eval(10, 5, 50, 1)", param_names_unary);
+
+	// === DISTRIBUTION PROPERTIES ===
+
+	REGISTER(loader, "summary", FunctionStability::CONSISTENT, DistributionSummaryType(),
+	         [](DataChunk &args, ExpressionState &state, Vector &result) {
+		         DistributionCallSummary<DISTRIBUTION>(args, state, result);
+	         },
+	         "Returns the mean, variance, standard deviation, skewness, kurtosis, median and mode of the " +
+	             DISTRIBUTION_TEXT + " as one struct. Moments that are undefined for the parameters are NULL.",
+	         "summary(10, 5, 50)");
+
+	REGISTER(loader, "mean", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_none([](const auto &dist) { return boost::math::mean(dist); }),
+	         "Returns the mean (μ) of the " + DISTRIBUTION_TEXT + ", which is the first moment.", "mean(10, 5, 50)");
+
+	REGISTER(loader, "stddev", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_none([](const auto &dist) { return boost::math::standard_deviation(dist); }),
+	         "Returns the standard deviation (σ) of the " + DISTRIBUTION_TEXT + ".", "stddev(10, 5, 50)");
+
+	REGISTER(loader, "variance", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_none([](const auto &dist) { return boost::math::variance(dist); }),
+	         "Returns the variance (σ²) of the " + DISTRIBUTION_TEXT + ".", "variance(10, 5, 50)");
+
+	REGISTER(loader, "mode", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_none([](const auto &dist) { return boost::math::mode(dist); }),
+	         "Returns the mode (most likely value) of the " + DISTRIBUTION_TEXT + ".",
+	         "mode(10, 5, 50)");
+
+	REGISTER(loader, "median", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_none([](const auto &dist) { return boost::math::median(dist); }),
+	         "Returns the median (50th percentile) of the " + DISTRIBUTION_TEXT + ".",
+	         "median(10, 5, 50)");
+
+	REGISTER(loader, "skewness", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_none([](const auto &dist) { return boost::math::skewness(dist); }),
+	         "Returns the skewness of the " + DISTRIBUTION_TEXT + ".", "skewness(10, 5, 50)");
+
+	REGISTER(loader, "kurtosis", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_none([](const auto &dist) { return boost::math::kurtosis(dist); }),
+	         "Returns the kurtosis of the " + DISTRIBUTION_TEXT + ".", "kurtosis(10, 5, 50)");
+
+	REGISTER(loader, "kurtosis_excess", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_none([](const auto &dist) { return boost::math::kurtosis_excess(dist); }),
+	         "Returns the excess kurtosis of the " + DISTRIBUTION_TEXT + ".", "kurtosis_excess(10, 5, 50)");
+
+	REGISTER(loader, "range", FunctionStability::CONSISTENT, LogicalType::ARRAY(LogicalType::DOUBLE, 2),
+	         make_none([](const auto &dist) {
+		         const auto bounds = boost::math::range(dist);
+		         return std::pair<double, double>(bounds.first, bounds.second);
+	         }),
+	         "Returns the range of the " + DISTRIBUTION_TEXT + ".", "range(10, 5, 50)");
+
+	REGISTER(loader, "support", FunctionStability::CONSISTENT, LogicalType::ARRAY(LogicalType::DOUBLE, 2),
+	         make_none([](const auto &dist) {
+		         const auto bounds = boost::math::support(dist);
+		         return std::pair<double, double>(bounds.first, bounds.second);
+	         }),
+	         "Returns the support of the " + DISTRIBUTION_TEXT + ".", "support(10, 5, 50)");
+
+	// No DISTRIBUTION value constructor: the type holds two parameters and this family has three.
+}
+} // end namespace duckdb
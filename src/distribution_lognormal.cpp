@@ -1,6 +1,7 @@
 #include "utils.hpp"
 #include "rng_utils.hpp"
 #include "distribution_traits.hpp"
+#include "normal_quantile.hpp"
 
 namespace duckdb {
 
@@ -24,11 +25,23 @@ struct distribution_traits_base {
 		return {logical_type_map<param1_t>::Get(), logical_type_map<param2_t>::Get()};
 	}
 
+	static bool ParametersValid(param1_t mean, param2_t stddev) {
+		return (stddev > 0) & std::isfinite(mean) & std::isfinite(stddev);
+	}
+
 	static void ValidateParameters(param1_t mean, param2_t stddev) {
 		if (stddev <= 0) {
 			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) +
 			                            ": Standard deviation must be > 0 was: " + std::to_string(stddev));
 		}
+		if (std::isinf(mean)) {
+			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) +
+			                            ": Mean must be finite was: " + std::to_string(mean));
+		}
+		if (std::isinf(stddev)) {
+			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) +
+			                            ": Standard deviation must be finite was: " + std::to_string(stddev));
+		}
 	}
 };
 
@@ -39,6 +52,20 @@ struct distribution_traits_base {
 DEFINE_DIST_TRAITS(DISTRIBUTION);
 DEFINE_DIST_TRAITS(SAMPLE_DISTRIBUTION);
 
+// Reduced precision instantiation used when stochastic_precision is 'fast'
+#define FAST_DISTRIBUTION boost::math::DISTRIBUTION_NAME<double, fast_precision_policy>
+DEFINE_DIST_TRAITS(FAST_DISTRIBUTION);
+
+// Single precision instantiations backing the FLOAT overloads
+#define FLOAT_DISTRIBUTION        boost::math::DISTRIBUTION_NAME<float>
+#define FLOAT_SAMPLE_DISTRIBUTION boost::random::DISTRIBUTION_NAME<float>
+#define DEFINE_FLOAT_DIST_TRAITS(DIST)                                                                                 \
+	template <>                                                                                                        \
+	struct distribution_traits<DIST> : public real_distribution_traits<distribution_traits_base<DIST>, float> {};
+
+DEFINE_FLOAT_DIST_TRAITS(FLOAT_DISTRIBUTION);
+DEFINE_FLOAT_DIST_TRAITS(FLOAT_SAMPLE_DISTRIBUTION);
+
 #define CONCAT(a, b)            a##b
 #define EXPAND_AND_CONCAT(a, b) CONCAT(a, b)
 
@@ -46,25 +73,40 @@ DEFINE_DIST_TRAITS(SAMPLE_DISTRIBUTION);
 
 LOAD_DISTRIBUTION_FN {
 	vector<std::pair<string, LogicalType>> param_names_quantile = {{"p", LogicalType::DOUBLE}};
+	vector<std::pair<string, LogicalType>> param_names_quantiles = {{"p", LogicalType::LIST(LogicalType::DOUBLE)}};
 	vector<std::pair<string, LogicalType>> param_names_unary = {{"x", LogicalType::DOUBLE}};
 
 	auto make_unary = [](auto func) {
 		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
-			DistributionCallBinaryUnary<DISTRIBUTION, double>(args, state, result, func);
+			if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+				DistributionCallUnary<FAST_DISTRIBUTION, double>(args, state, result, func);
+			} else {
+				DistributionCallUnary<DISTRIBUTION, double>(args, state, result, func);
+			}
+		};
+	};
+
+	auto make_list = [](auto func) {
+		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
+			if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+				DistributionCallList<FAST_DISTRIBUTION>(args, state, result, func);
+			} else {
+				DistributionCallList<DISTRIBUTION>(args, state, result, func);
+			}
 		};
 	};
 
 	auto make_none = [](auto func) {
 		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
-			DistributionCallBinaryNone<DISTRIBUTION>(args, state, result,
-			                                         [func](Vector &result, const auto &dist) { return func(dist); });
+			DistributionCallNone<DISTRIBUTION>(args, state, result,
+			                                   [func](Vector &result, const auto &dist) { return func(dist); });
 		};
 	};
 
 	REGISTER(
 	    loader, "sample", FunctionStability::VOLATILE, LogicalType::DOUBLE,
 	    [](DataChunk &args, ExpressionState &state, Vector &result) {
-		    DistributionSampleBinary<SAMPLE_DISTRIBUTION, double>(args, state, result);
+		    DistributionSample<SAMPLE_DISTRIBUTION, double>(args, state, result);
 	    },
 	    "Generates random samples from the " + DISTRIBUTION_TEXT + " with specified parameters.", "sample(0.0, 1.0)");
 
@@ -117,22 +159,50 @@ LOAD_DISTRIBUTION_FN {
 	         "log_cdf_complement(0, 1.0, 0.5)", param_names_unary);
 
 	// === QUANTILE FUNCTIONS ===
+	// Both go through the batch AS 241 kernel; p outside (0, 1) is left to boost::math.
+	auto quantile_boost =
+	    make_unary([](const auto &dist, auto p) -> DISTRIBUTION::value_type { return boost::math::quantile(dist, p); });
+	auto quantile_complement_boost = make_unary([](const auto &dist, auto p) -> DISTRIBUTION::value_type {
+		return boost::math::quantile(boost::math::complement(dist, p));
+	});
+
 	REGISTER(
 	    loader, "quantile", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
-	    make_unary([](const auto &dist, auto p) -> DISTRIBUTION::value_type { return boost::math::quantile(dist, p); }),
+	    [quantile_boost](DataChunk &args, ExpressionState &state, Vector &result) {
+		    auto op = [](const auto &dist, auto z) -> double { return std::exp(dist.location() + dist.scale() * z); };
+		    if (!NormalQuantileBatch<DISTRIBUTION>(args, state, result, op)) {
+			    quantile_boost(args, state, result);
+		    }
+	    },
 	    "Computes the quantile function (inverse CDF) of the " + DISTRIBUTION_TEXT +
 	        ". Returns the value x "
 	        "such that P(X ≤ x) = p, where p is the cumulative probability.",
 	    "quantile(0, 1.0, 0.95)", param_names_quantile);
 
-	REGISTER(loader, "quantile_complement", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
-	         make_unary([](const auto &dist, auto p) -> DISTRIBUTION::value_type {
-		         return boost::math::quantile(boost::math::complement(dist, p));
-	         }),
-	         "Computes the complementary quantile function of the " + DISTRIBUTION_TEXT +
-	             ". Returns the value x "
-	             "such that P(X > x) = p, useful for computing upper tail quantiles.",
-	         "quantile_complement(0, 1.0, 0.95)", param_names_quantile);
+	REGISTER(
+	    loader, "quantile_complement", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	    [quantile_complement_boost](DataChunk &args, ExpressionState &state, Vector &result) {
+		    auto op = [](const auto &dist, auto z) -> double { return std::exp(dist.location() - dist.scale() * z); };
+		    if (!NormalQuantileBatch<DISTRIBUTION>(args, state, result, op)) {
+			    quantile_complement_boost(args, state, result);
+		    }
+	    },
+	    "Computes the complementary quantile function of the " + DISTRIBUTION_TEXT +
+	        ". Returns the value x "
+	        "such that P(X > x) = p, useful for computing upper tail quantiles.",
+	    "quantile_complement(0, 1.0, 0.95)", param_names_quantile);
+
+	REGISTER(
+	    loader, "quantiles", FunctionStability::CONSISTENT, LogicalType::LIST(LogicalType::DOUBLE),
+	    make_list([](const auto &dist, auto p) -> DISTRIBUTION::value_type {
+		    if (p > 0 && p < 1) {
+			    return std::exp(dist.location() + dist.scale() * StandardNormalQuantile(p));
+		    }
+		    return boost::math::quantile(dist, p);
+	    }),
+	    "Computes the quantile function of the " + DISTRIBUTION_TEXT +
+	        " at every probability of a list, building the distribution once for the row.",
+	    "quantiles(0, 1.0, [0.05, 0.5, 0.95])", param_names_quantiles);
 
 	REGISTER(
 	    loader, "hazard", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
@@ -144,8 +214,29 @@ LOAD_DISTRIBUTION_FN {
 	         "Computes the cumulative hazard function of the " + DISTRIBUTION_TEXT + ".", "chf(0, 1.0, 0.5)",
 	         param_names_unary);
 
+	REGISTER(
+	    loader, "eval", FunctionStability::CONSISTENT, DistributionEvalType(),
+	    [](DataChunk &args, ExpressionState &state, Vector &result) {
+		    if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+			    DistributionCallEval<FAST_DISTRIBUTION, double>(args, state, result);
+		    } else {
+			    DistributionCallEval<DISTRIBUTION, double>(args, state, result);
+		    }
+	    },
+	    "Evaluates the PDF, log-PDF, CDF, survival function and hazard of the " + DISTRIBUTION_TEXT +
+	        " at x as one struct, computing the PDF and survival function once for all of them.",
+	    "eval(0, 1.0, 0.5)", param_names_unary);
+
 	// === DISTRIBUTION PROPERTIES ===
 
+	REGISTER(loader, "summary", FunctionStability::CONSISTENT, DistributionSummaryType(),
+	         [](DataChunk &args, ExpressionState &state, Vector &result) {
+		         DistributionCallSummary<DISTRIBUTION>(args, state, result);
+	         },
+	         "Returns the mean, variance, standard deviation, skewness, kurtosis, median and mode of the " +
+	             DISTRIBUTION_TEXT + " as one struct. Moments that are undefined for the parameters are NULL.",
+	         "summary(0.0, 1.0)");
+
 	REGISTER(loader, "mean", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
 	         make_none([](const auto &dist) { return boost::math::mean(dist); }),
 	         "Returns the mean (μ) of the " + DISTRIBUTION_TEXT + ", which is the first moment.", "mean(0.0, 1.0)");
@@ -187,5 +278,12 @@ LOAD_DISTRIBUTION_FN {
 	REGISTER(loader, "support", FunctionStability::CONSISTENT, LogicalType::ARRAY(LogicalType::DOUBLE, 2),
 	         make_none([](const auto &dist) { return boost::math::support(dist); }),
 	         "Returns the support of the " + DISTRIBUTION_TEXT + ".", "support(0.0, 1.0)");
+
+	// === DISTRIBUTION VALUE ===
+	RegisterDistributionConstructor<DISTRIBUTION>(loader, DISTRIBUTION_TEXT, "0.0, 1.0");
+
+	// === SINGLE PRECISION OVERLOADS ===
+	RegisterFloatOverloads<FLOAT_DISTRIBUTION, FLOAT_SAMPLE_DISTRIBUTION>(loader, DISTRIBUTION_TEXT,
+	                                                                      "0.0::FLOAT, 1.0::FLOAT", "0.5::FLOAT");
 }
 } // end namespace duckdb
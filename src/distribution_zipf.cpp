@@ -0,0 +1,259 @@
+#include "utils.hpp"
+#include "rng_utils.hpp"
+#include "distribution_traits.hpp"
+#include "pmf_recurrence.hpp"
+#include "zipf_distribution.hpp"
+
+namespace duckdb {
+
+#define DISTRIBUTION_SHORT_NAME "zipf"
+#define DISTRIBUTION_TEXT       string(string(DISTRIBUTION_SHORT_NAME) + " distribution")
+#define DISTRIBUTION_NAME       zipf_distribution
+#define DISTRIBUTION            boost::math::DISTRIBUTION_NAME<double>
+#define SAMPLE_DISTRIBUTION     zipf_sampler<int64_t>
+#define REGISTER                RegisterFunction<DISTRIBUTION>
+
+template <typename DistType>
+struct distribution_traits_base {
+	using param1_t = int64_t;
+	using param2_t = double;
+	using return_t = double;
+
+	static constexpr std::array<const char *, 2> param_names = {"n", "s"};
+	static constexpr const char *prefix = DISTRIBUTION_SHORT_NAME;
+
+	static std::vector<LogicalType> LogicalParamTypes() {
+		return {logical_type_map<param1_t>::Get(), logical_type_map<param2_t>::Get()};
+	}
+
+	static bool ParametersValid(param1_t n, param2_t s) {
+		return (n >= 1) & (s > 0) & (s <= std::numeric_limits<double>::max());
+	}
+
+	static void ValidateParameters(param1_t n, param2_t s) {
+		if (n < 1) {
+			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) +
+			                            ": Number of elements must be >= 1 was: " + std::to_string(n));
+		}
+		if (!(s > 0) || s > std::numeric_limits<double>::max()) {
+			throw InvalidInputException(string(DISTRIBUTION_SHORT_NAME) +
+			                            ": Exponent must be > 0 and finite was: " + std::to_string(s));
+		}
+	}
+};
+
+#define DEFINE_DIST_TRAITS(DIST)                                                                                       \
+	template <>                                                                                                        \
+	struct distribution_traits<DIST> : public distribution_traits_base<DIST> {};
+
+DEFINE_DIST_TRAITS(DISTRIBUTION);
+DEFINE_DIST_TRAITS(SAMPLE_DISTRIBUTION);
+
+// pmf(k + 1) / pmf(k) = (k / (k + 1))^s; pmf(0) is zero, so the walk down from the mode ends there.
+template <>
+struct pmf_recurrence<DISTRIBUTION> {
+	static double Ratio(const DISTRIBUTION &dist, double k) {
+		return k > 0 ? std::pow(k / (k + 1), dist.exponent()) : std::numeric_limits<double>::infinity();
+	}
+};
+
+#define CONCAT(a, b)            a##b
+#define EXPAND_AND_CONCAT(a, b) CONCAT(a, b)
+
+#define LOAD_DISTRIBUTION_FN void EXPAND_AND_CONCAT(Load_, DISTRIBUTION_NAME)(ExtensionLoader & loader)
+
+LOAD_DISTRIBUTION_FN {
+	vector<std::pair<string, LogicalType>> param_names_quantile = {{"p", LogicalType::DOUBLE}};
+	vector<std::pair<string, LogicalType>> param_names_quantiles = {{"p", LogicalType::LIST(LogicalType::DOUBLE)}};
+	vector<std::pair<string, LogicalType>> param_names_unary = {{"x", LogicalType::DOUBLE}};
+	vector<std::pair<string, LogicalType>> param_names_kmax = {{"kmax", LogicalType::BIGINT}};
+
+	auto make_unary = [](auto func) {
+		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
+			DistributionCallUnary<DISTRIBUTION, double>(args, state, result, func);
+		};
+	};
+
+	auto make_list = [](auto func) {
+		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
+			DistributionCallList<DISTRIBUTION>(args, state, result, func);
+		};
+	};
+
+	auto make_none = [](auto func) {
+		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
+			DistributionCallNone<DISTRIBUTION>(args, state, result,
+			                                   [func](Vector &result, const auto &dist) { return func(dist); });
+		};
+	};
+
+	REGISTER(
+	    loader, "sample", FunctionStability::VOLATILE, LogicalType::BIGINT,
+	    [](DataChunk &args, ExpressionState &state, Vector &result) {
+		    DistributionSampleBatch<SAMPLE_DISTRIBUTION, int64_t>(args, state, result);
+	    },
+	    "Generates random samples from the " + DISTRIBUTION_TEXT + " with specified parameters.", "sample(1000, 1.1)");
+
+	REGISTER(loader, "pdf", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::pdf(dist, x); }),
+	         "Computes the probability density function (PDF) of the " + DISTRIBUTION_TEXT +
+	             ". Returns the probability density"
+	             "at point x for a " +
+	             DISTRIBUTION_TEXT + " with specified parameters.",
+	         "pdf(1000, 1.1, 2)", param_names_unary);
+
+	REGISTER(
+	    loader, "log_pdf", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	    make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::logpdf(dist, x); }),
+	    "Computes the natural logarithm of the probability density function (log-PDF) of the " + DISTRIBUTION_TEXT +
+	        ". Useful for numerical stability when dealing with very small probabilities.",
+	    "log_pdf(1000, 1.1, 2)", param_names_unary);
+
+	REGISTER(
+	    loader, "pmf_range", FunctionStability::CONSISTENT, LogicalType::LIST(LogicalType::DOUBLE),
+	    [](DataChunk &args, ExpressionState &state, Vector &result) {
+		    DistributionCallPmfRange<DISTRIBUTION>(args, state, result);
+	    },
+	    "Computes the probability mass function of the " + DISTRIBUTION_TEXT +
+	        " at 0, 1, ..., kmax and returns it as a list. The values are computed by recurrence from the mode.",
+	    "pmf_range(1000, 1.1, 10)", param_names_kmax);
+
+	// === CUMULATIVE DISTRIBUTION FUNCTIONS ===
+	// Chunks with constant parameters and ascending integer x are evaluated by recurrence.
+	auto cdf_boost =
+	    make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::cdf(dist, x); });
+
+	REGISTER(loader, "cdf", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         [cdf_boost](DataChunk &args, ExpressionState &state, Vector &result) {
+		         if (!DiscreteCdfRange<DISTRIBUTION>(args, state, result)) {
+			         cdf_boost(args, state, result);
+		         }
+	         },
+	         "Computes the cumulative distribution function (CDF) of the " + DISTRIBUTION_TEXT +
+	             ". Returns the "
+	             "probability that a random variable X is less than or equal to x.",
+	         "cdf(1000, 1.1, 2)", param_names_unary);
+
+	REGISTER(loader, "cdf_complement", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type {
+		         return boost::math::cdf(boost::math::complement(dist, x));
+	         }),
+	         "Computes the complementary cumulative distribution function (1 - CDF) of the " + DISTRIBUTION_TEXT +
+	             ". Returns the probability that X > x, equivalent to the survival function.",
+	         "cdf_complement(1000, 1.1, 2)", param_names_unary);
+
+	REGISTER(
+	    loader, "log_cdf", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	    make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::logcdf(dist, x); }),
+	    "Computes the natural logarithm of the cumulative distribution function (CDF) of the " + DISTRIBUTION_TEXT +
+	        ". "
+	        "Returns the logarithm of the probability that a random variable X is less than or equal to x.",
+	    "log_cdf(1000, 1.1, 2)", param_names_unary);
+
+	REGISTER(loader, "log_cdf_complement", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type {
+		         return boost::math::logcdf(boost::math::complement(dist, x));
+	         }),
+	         "Computes the natural logarithm of the complementary cumulative distribution function (1 - CDF) of the " +
+	             DISTRIBUTION_TEXT +
+	             ". Returns the logarithm of the probability that X > x, equivalent to the survival function.",
+	         "log_cdf_complement(1000, 1.1, 2)", param_names_unary);
+
+	// === QUANTILE FUNCTIONS ===
+	REGISTER(
+	    loader, "quantile", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	    make_unary([](const auto &dist, auto p) -> DISTRIBUTION::value_type { return boost::math::quantile(dist, p); }),
+	    "Computes the quantile function (inverse CDF) of the " + DISTRIBUTION_TEXT +
+	        ". Returns the value x "
+	        "such that P(X ≤ x) = p, where p is the cumulative probability.",
+	    "quantile(1000, 1.1, 0.95)", param_names_quantile);
+
+	REGISTER(loader, "quantile_complement", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_unary([](const auto &dist, auto p) -> DISTRIBUTION::value_type {
+		         return boost::math::quantile(boost::math::complement(dist, p));
+	         }),
+	         "Computes the complementary quantile function of the " + DISTRIBUTION_TEXT +
+	             ". Returns the value x "
+	             "such that P(X > x) = p, useful for computing upper tail quantiles.",
+	         "quantile_complement(1000, 1.1, 0.05)", param_names_quantile);
+
+	REGISTER(
+	    loader, "quantiles", FunctionStability::CONSISTENT, LogicalType::LIST(LogicalType::DOUBLE),
+	    make_list([](const auto &dist, auto p) -> DISTRIBUTION::value_type { return boost::math::quantile(dist, p); }),
+	    "Computes the quantile function of the " + DISTRIBUTION_TEXT +
+	        " at every probability of a list, building the distribution once for the row.",
+	    "quantiles(1000, 1.1, [0.05, 0.5, 0.95])", param_names_quantiles);
+
+	REGISTER(
+	    loader, "hazard", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	    make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::hazard(dist, x); }),
+	    "Computes the hazard function of the " + DISTRIBUTION_TEXT + ".", "hazard(1000, 1.1, 2)", param_names_unary);
+
+	REGISTER(loader, "chf", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_unary([](const auto &dist, auto x) -> DISTRIBUTION::value_type { return boost::math::chf(dist, x); }),
+	         "Computes the cumulative hazard function of the " + DISTRIBUTION_TEXT + ".", "chf(1000, 1.1, 2)",
+	         param_names_unary);
+
+	REGISTER(
+	    loader, "eval", FunctionStability::CONSISTENT, DistributionEvalType(),
+	    [](DataChunk &args, ExpressionState &state, Vector &result) {
+		    DistributionCallEval<DISTRIBUTION, double>(args, state, result);
+	    },
+	    "Evaluates the PDF, log-PDF, CDF, survival function and hazard of the " + DISTRIBUTION_TEXT +
+	        " at x as one struct, computing the PDF and survival function once for all of them.",
+	    "eval(1000, 1.1, 2)", param_names_unary);
+
+	// === DISTRIBUTION PROPERTIES ===
+
+	REGISTER(loader, "summary", FunctionStability::CONSISTENT, DistributionSummaryType(),
+	         [](DataChunk &args, ExpressionState &state, Vector &result) {
+		         DistributionCallSummary<DISTRIBUTION>(args, state, result);
+	         },
+	         "Returns the mean, variance, standard deviation, skewness, kurtosis, median and mode of the " +
+	             DISTRIBUTION_TEXT + " as one struct. Moments that are undefined for the parameters are NULL.",
+	         "summary(1000, 1.1)");
+
+	REGISTER(loader, "mean", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_none([](const auto &dist) { return boost::math::mean(dist); }),
+	         "Returns the mean (μ) of the " + DISTRIBUTION_TEXT + ", which is the first moment.", "mean(1000, 1.1)");
+
+	REGISTER(loader, "stddev", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_none([](const auto &dist) { return boost::math::standard_deviation(dist); }),
+	         "Returns the standard deviation (σ) of the " + DISTRIBUTION_TEXT + ".", "stddev(1000, 1.1)");
+
+	REGISTER(loader, "variance", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_none([](const auto &dist) { return boost::math::variance(dist); }),
+	         "Returns the variance (σ²) of the " + DISTRIBUTION_TEXT + ".", "variance(1000, 1.1)");
+
+	REGISTER(loader, "mode", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_none([](const auto &dist) { return boost::math::mode(dist); }),
+	         "Returns the mode (most likely value) of the " + DISTRIBUTION_TEXT + ".", "mode(1000, 1.1)");
+
+	REGISTER(loader, "median", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_none([](const auto &dist) { return boost::math::median(dist); }),
+	         "Returns the median (50th percentile) of the " + DISTRIBUTION_TEXT + ".", "median(1000, 1.1)");
+
+	REGISTER(loader, "skewness", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_none([](const auto &dist) { return boost::math::skewness(dist); }),
+	         "Returns the skewness of the " + DISTRIBUTION_TEXT + ".", "skewness(1000, 1.1)");
+
+	REGISTER(loader, "kurtosis", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_none([](const auto &dist) { return boost::math::kurtosis(dist); }),
+	         "Returns the kurtosis of the " + DISTRIBUTION_TEXT + ".", "kurtosis(1000, 1.1)");
+
+	REGISTER(loader, "kurtosis_excess", FunctionStability::CONSISTENT, LogicalType::DOUBLE,
+	         make_none([](const auto &dist) { return boost::math::kurtosis_excess(dist); }),
+	         "Returns the excess kurtosis of the " + DISTRIBUTION_TEXT + ".", "kurtosis_excess(1000, 1.1)");
+
+	REGISTER(loader, "range", FunctionStability::CONSISTENT, LogicalType::ARRAY(LogicalType::DOUBLE, 2),
+	         make_none([](const auto &dist) { return boost::math::range(dist); }),
+	         "Returns the range of the " + DISTRIBUTION_TEXT + ".", "range(1000, 1.1)");
+
+	REGISTER(loader, "support", FunctionStability::CONSISTENT, LogicalType::ARRAY(LogicalType::DOUBLE, 2),
+	         make_none([](const auto &dist) { return boost::math::support(dist); }),
+	         "Returns the support of the " + DISTRIBUTION_TEXT + ".", "support(1000, 1.1)");
+
+	// === DISTRIBUTION VALUE ===
+	RegisterDistributionConstructor<DISTRIBUTION>(loader, DISTRIBUTION_TEXT, "1000, 1.1");
+}
+} // end namespace duckdb
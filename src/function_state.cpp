@@ -0,0 +1,83 @@
+#include "function_state.hpp"
+#include "stochastic_cache.hpp"
+#include "stochastic_stats.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+
+namespace duckdb {
+
+static StochasticPrecision ParsePrecision(const Value &value) {
+	auto text = StringUtil::Lower(value.ToString());
+	if (text == "full") {
+		return StochasticPrecision::FULL;
+	}
+	if (text == "fast") {
+		return StochasticPrecision::FAST;
+	}
+	throw InvalidInputException("stochastic_precision must be 'full' or 'fast', was: " + value.ToString());
+}
+
+static void SetPrecision(ClientContext &context, SetScope scope, Value &parameter) {
+	ParsePrecision(parameter);
+}
+
+static StochasticErrorMode ParseErrorMode(const Value &value) {
+	auto text = StringUtil::Lower(value.ToString());
+	if (text == "error") {
+		return StochasticErrorMode::RAISE;
+	}
+	if (text == "null") {
+		return StochasticErrorMode::RETURN_NULL;
+	}
+	throw InvalidInputException("stochastic_error_mode must be 'error' or 'null', was: " + value.ToString());
+}
+
+static void SetErrorMode(ClientContext &context, SetScope scope, Value &parameter) {
+	ParseErrorMode(parameter);
+}
+
+StochasticFunctionLocalState::~StochasticFunctionLocalState() {
+	if (counters) {
+		stats->Retire(*counters);
+	}
+}
+
+unique_ptr<FunctionLocalState> StochasticFunctionLocalState::Init(ExpressionState &state,
+                                                                  const BoundFunctionExpression &expr,
+                                                                  FunctionData *bind_data) {
+	auto precision = StochasticPrecision::FULL;
+	Value precision_value;
+	if (state.GetContext().TryGetCurrentSetting(STOCHASTIC_PRECISION_SETTING, precision_value) &&
+	    !precision_value.IsNull()) {
+		precision = ParsePrecision(precision_value);
+	}
+	auto error_mode = StochasticErrorMode::RAISE;
+	Value error_mode_value;
+	if (state.GetContext().TryGetCurrentSetting(STOCHASTIC_ERROR_MODE_SETTING, error_mode_value) &&
+	    !error_mode_value.IsNull()) {
+		error_mode = ParseErrorMode(error_mode_value);
+	}
+	idx_t cache_size = STOCHASTIC_CACHE_DEFAULT_SIZE;
+	Value cache_size_value;
+	if (state.GetContext().TryGetCurrentSetting(STOCHASTIC_CACHE_SIZE_SETTING, cache_size_value) &&
+	    !cache_size_value.IsNull()) {
+		cache_size = cache_size_value.GetValue<uint64_t>();
+	}
+	return make_uniq<StochasticFunctionLocalState>(StochasticStats::GetFunctionId(expr.function.name), precision,
+	                                               error_mode, cache_size);
+}
+
+void LoadStochasticSettings(ExtensionLoader &loader) {
+	auto &config = DBConfig::GetConfig(loader.GetDatabaseInstance());
+	config.AddExtensionOption(STOCHASTIC_PRECISION_SETTING,
+	                          "Accuracy of the distribution functions: 'full' (double precision) or 'fast' "
+	                          "(about 1e-9 relative accuracy, errors return NaN instead of raising)",
+	                          LogicalType::VARCHAR, Value("full"), SetPrecision);
+	config.AddExtensionOption(STOCHASTIC_ERROR_MODE_SETTING,
+	                          "Handling of invalid distribution parameters: 'error' (raise) or 'null' (the row "
+	                          "returns NULL)",
+	                          LogicalType::VARCHAR, Value("error"), SetErrorMode);
+}
+
+} // namespace duckdb
@@ -0,0 +1,882 @@
+#pragma once
+#include "duckdb.hpp"
+#include "rng_utils.hpp"
+#include "zipf_distribution.hpp"
+#include <boost/math/distributions/hypergeometric.hpp>
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+namespace duckdb {
+
+// Samplers that draw a whole chunk at once. SampleBatch receives the parameters of the rows to
+// sample as flat arrays (rows with NULL or invalid parameters already removed) and writes one
+// sample per row; see DistributionSampleBatch. Like the inverse transform samplers they take
+// the parameters in the order of the boost::math distribution of their file.
+struct batch_sampler {};
+
+template <typename T>
+constexpr bool is_batch_sampler_v = std::is_base_of_v<batch_sampler, T>;
+
+// Samples are passed through a double buffer unless the sampler declares another sample_type.
+template <typename T, typename = void>
+struct batch_sample_type {
+	using type = double;
+};
+
+template <typename T>
+struct batch_sample_type<T, std::void_t<typename T::sample_type>> {
+	using type = typename T::sample_type;
+};
+
+// Samplers may also provide SampleConstant(count, params..., out), which is used instead of
+// SampleBatch when all parameters are constant.
+template <typename T, typename = void>
+constexpr bool has_constant_sample_batch_v = false;
+
+template <typename T>
+constexpr bool has_constant_sample_batch_v<T, std::void_t<decltype(&T::SampleConstant)>> = true;
+
+// Fills out[i] with a Gamma(shape[i], 1) variate by the Marsaglia–Tsang method. Every pass
+// draws normals and uniforms for all pending rows, evaluates the acceptance test over them
+// without branches and compacts the rejected rows into the next pass; about 4% of rows are
+// retried. Shapes below one are boosted: Gamma(a) = Gamma(a + 1) * U^(1 / a). A non-finite
+// shape, for which the acceptance test would be NaN on every pass, gives itself (an infinite
+// shape an infinite variate) and never enters the loop.
+static inline void SampleStandardGamma(idx_t count, const double *shape, double *out) {
+	double d[STANDARD_VECTOR_SIZE];
+	double c[STANDARD_VECTOR_SIZE];
+	sel_t pending[STANDARD_VECTOR_SIZE];
+	bool any_boosted = false;
+	idx_t pending_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		any_boosted |= shape[i] < 1;
+		const double boosted_shape = shape[i] < 1 ? shape[i] + 1 : shape[i];
+		d[i] = boosted_shape - 1.0 / 3.0;
+		c[i] = 1 / std::sqrt(9 * d[i]);
+		out[i] = shape[i];
+		pending[pending_count] = sel_t(i);
+		pending_count += std::isfinite(shape[i]);
+	}
+
+	double normals[STANDARD_VECTOR_SIZE];
+	double uniforms[STANDARD_VECTOR_SIZE];
+	while (pending_count > 0) {
+		FillStandardNormal(normals, pending_count);
+		FillUniformOpen01(uniforms, pending_count);
+		idx_t retry_count = 0;
+		for (idx_t j = 0; j < pending_count; j++) {
+			const auto row = pending[j];
+			const double x = normals[j];
+			const double t = 1 + c[row] * x;
+			const double v = t * t * t;
+			// For v <= 0 the logarithm is NaN or -inf and the comparison fails.
+			const bool accept = (v > 0) & (std::log(uniforms[j]) < 0.5 * x * x + d[row] * (1 - v + std::log(v)));
+			out[row] = d[row] * v;
+			pending[retry_count] = row;
+			retry_count += !accept;
+		}
+		pending_count = retry_count;
+	}
+
+	if (!any_boosted) {
+		return;
+	}
+	FillUniformOpen01(uniforms, count);
+	for (idx_t i = 0; i < count; i++) {
+		out[i] *= shape[i] < 1 ? std::pow(uniforms[i], 1 / shape[i]) : 1.0;
+	}
+}
+
+// Fills out[i] with a chi-squared variate with degrees_of_freedom[i] degrees of freedom.
+static inline void SampleChiSquared(idx_t count, const double *degrees_of_freedom, double *out) {
+	double half_df[STANDARD_VECTOR_SIZE];
+	for (idx_t i = 0; i < count; i++) {
+		half_df[i] = degrees_of_freedom[i] / 2;
+	}
+	SampleStandardGamma(count, half_df, out);
+	for (idx_t i = 0; i < count; i++) {
+		out[i] *= 2;
+	}
+}
+
+template <typename RealType = double>
+struct gamma_sampler : public batch_sampler {
+	using result_type = RealType;
+
+	static void SampleBatch(idx_t count, const double *shape, const double *scale, double *out) {
+		SampleStandardGamma(count, shape, out);
+		for (idx_t i = 0; i < count; i++) {
+			out[i] *= scale[i];
+		}
+	}
+};
+
+template <typename RealType = double>
+struct beta_sampler : public batch_sampler {
+	using result_type = RealType;
+
+	// X / (X + Y) for X ~ Gamma(alpha), Y ~ Gamma(beta).
+	static void SampleBatch(idx_t count, const double *alpha, const double *beta, double *out) {
+		double y[STANDARD_VECTOR_SIZE];
+		SampleStandardGamma(count, alpha, out);
+		SampleStandardGamma(count, beta, y);
+		for (idx_t i = 0; i < count; i++) {
+			out[i] = out[i] / (out[i] + y[i]);
+		}
+	}
+};
+
+template <typename RealType = double>
+struct chi_squared_sampler : public batch_sampler {
+	using result_type = RealType;
+
+	static void SampleBatch(idx_t count, const double *degrees_of_freedom, double *out) {
+		SampleChiSquared(count, degrees_of_freedom, out);
+	}
+};
+
+template <typename RealType = double>
+struct students_t_sampler : public batch_sampler {
+	using result_type = RealType;
+
+	// Z / sqrt(V / df) for Z standard normal and V chi-squared with df degrees of freedom. An
+	// infinite df, which ParametersValid accepts, is the standard normal itself.
+	static void SampleBatch(idx_t count, const double *degrees_of_freedom, double *out) {
+		double chi_squared[STANDARD_VECTOR_SIZE];
+		SampleChiSquared(count, degrees_of_freedom, chi_squared);
+		FillStandardNormal(out, count);
+		for (idx_t i = 0; i < count; i++) {
+			out[i] /= std::isinf(degrees_of_freedom[i]) ? 1.0 : std::sqrt(chi_squared[i] / degrees_of_freedom[i]);
+		}
+	}
+};
+
+template <typename RealType = double>
+struct fisher_f_sampler : public batch_sampler {
+	using result_type = RealType;
+
+	// (U / d1) / (V / d2) for U, V chi-squared with d1 and d2 degrees of freedom.
+	static void SampleBatch(idx_t count, const double *d1, const double *d2, double *out) {
+		double denominator[STANDARD_VECTOR_SIZE];
+		SampleChiSquared(count, d1, out);
+		SampleChiSquared(count, d2, denominator);
+		for (idx_t i = 0; i < count; i++) {
+			out[i] = (out[i] / d1[i]) / (denominator[i] / d2[i]);
+		}
+	}
+};
+
+// CDF table of a discrete distribution with a small mean, used to sample it by inversion. The
+// table is rebuilt only when the parameters change from one row to the next, so constant
+// parameters build it once per chunk. Tail mass past the last entry (below 1e-16 for the means
+// it is used with) is folded into the last entry.
+struct InversionTable {
+	static constexpr idx_t MAX_SIZE = 128;
+	double cdf[MAX_SIZE];
+	idx_t size = 0;
+
+	void BuildPoisson(double rate) {
+		double pmf = std::exp(-rate);
+		double cumulative = pmf;
+		cdf[0] = cumulative;
+		size = 1;
+		while (size < MAX_SIZE && (double(size) <= rate || pmf > 1e-17)) {
+			pmf *= rate / double(size);
+			cumulative += pmf;
+			cdf[size++] = cumulative;
+		}
+		cdf[size - 1] = 1.0;
+	}
+
+	void BuildBinomial(double trials, double prob) {
+		const double odds = prob / (1 - prob);
+		double pmf = std::exp(trials * std::log1p(-prob));
+		double cumulative = pmf;
+		cdf[0] = cumulative;
+		size = 1;
+		while (size < MAX_SIZE && double(size) <= trials && (double(size) <= trials * prob || pmf > 1e-17)) {
+			pmf *= (trials - double(size) + 1) / double(size) * odds;
+			cumulative += pmf;
+			cdf[size++] = cumulative;
+		}
+		cdf[size - 1] = 1.0;
+	}
+
+	// The reduced hypergeometric of HypergeometricReduction, whose support starts at 0. The first
+	// term comes from boost::math, which stays accurate where differences of lgamma would not.
+	void BuildHypergeometric(double n1, double n2, double k) {
+		const double total = n1 + n2;
+		const boost::math::hypergeometric_distribution<double> dist {unsigned(n1), unsigned(k), unsigned(total)};
+		double pmf = boost::math::pdf(dist, 0u);
+		double cumulative = pmf;
+		cdf[0] = cumulative;
+		size = 1;
+		const double mean = k * n1 / total;
+		const double last = std::min(n1, k);
+		while (size < MAX_SIZE && double(size) <= last && (double(size) <= mean || pmf > 1e-17)) {
+			const double i = double(size);
+			pmf *= (n1 - i + 1) * (k - i + 1) / (i * (n2 - k + i));
+			cumulative += pmf;
+			cdf[size++] = cumulative;
+		}
+		cdf[size - 1] = 1.0;
+	}
+
+	// Smallest k with u <= cdf[k].
+	double Find(double u) const {
+		return double(std::lower_bound(cdf, cdf + size, u) - cdf);
+	}
+};
+
+// Poisson variates for rates of at least POISSON_PTRS_MIN_RATE by Hormann's transformed
+// rejection with squeeze (PTRS). Rejected rows are compacted into the next pass.
+static constexpr double POISSON_PTRS_MIN_RATE = 10;
+
+static inline void SamplePoissonPTRS(idx_t count, sel_t *pending, const double *rate, double *out) {
+	double a[STANDARD_VECTOR_SIZE];
+	double b[STANDARD_VECTOR_SIZE];
+	double log_inv_alpha[STANDARD_VECTOR_SIZE];
+	double v_r[STANDARD_VECTOR_SIZE];
+	for (idx_t j = 0; j < count; j++) {
+		const auto row = pending[j];
+		b[row] = 0.931 + 2.53 * std::sqrt(rate[row]);
+		a[row] = -0.059 + 0.02483 * b[row];
+		log_inv_alpha[row] = std::log(1.1239 + 1.1328 / (b[row] - 3.4));
+		v_r[row] = 0.9277 - 3.6224 / (b[row] - 2);
+	}
+
+	double u[STANDARD_VECTOR_SIZE];
+	double v[STANDARD_VECTOR_SIZE];
+	idx_t pending_count = count;
+	while (pending_count > 0) {
+		FillUniformOpen01(u, pending_count);
+		FillUniformOpen01(v, pending_count);
+		idx_t retry_count = 0;
+		for (idx_t j = 0; j < pending_count; j++) {
+			const auto row = pending[j];
+			const double lambda = rate[row];
+			const double centered = u[j] - 0.5;
+			const double us = 0.5 - std::fabs(centered);
+			const double k = std::floor((2 * a[row] / us + b[row]) * centered + lambda + 0.43);
+			const bool accept =
+			    ((us >= 0.07) & (v[j] <= v_r[row])) ||
+			    ((k >= 0) & !((us < 0.013) & (v[j] > us)) &&
+			     std::log(v[j]) + log_inv_alpha[row] - std::log(a[row] / (us * us) + b[row]) <=
+			         -lambda + k * std::log(lambda) - std::lgamma(k + 1));
+			out[row] = k;
+			pending[retry_count] = row;
+			retry_count += !accept;
+		}
+		pending_count = retry_count;
+	}
+}
+
+// Binomial variates for n * min(p, 1 - p) of at least BINOMIAL_BTRD_MIN_MEAN by Hormann's
+// transformed rejection with decomposition (BTRD), for p <= 0.5; the caller reflects larger p.
+static constexpr double BINOMIAL_BTRD_MIN_MEAN = 10;
+
+struct BinomialBTRD {
+	double n, p, m, r, nr, npq, b, a, c, alpha, v_r, u_rv_r;
+
+	BinomialBTRD(double n, double p) : n(n), p(p) {
+		m = std::floor((n + 1) * p);
+		r = p / (1 - p);
+		nr = (n + 1) * r;
+		npq = n * p * (1 - p);
+		const double sqrt_npq = std::sqrt(npq);
+		b = 1.15 + 2.53 * sqrt_npq;
+		a = -0.0873 + 0.0248 * b + 0.01 * p;
+		c = n * p + 0.5;
+		alpha = (2.83 + 5.1 / b) * sqrt_npq;
+		v_r = 0.92 - 4.2 / b;
+		u_rv_r = 0.86 * v_r;
+	}
+
+	// Stirling series correction log(k!) - log(sqrt(2 pi) (k + 1)^(k + 1/2) e^-(k + 1)).
+	static double StirlingCorrection(double k) {
+		static constexpr double table[] = {0.08106146679532726,  0.04134069595540929,  0.02767792568499834,
+		                                   0.02079067210376509,  0.01664469118982119,  0.01387612882307075,
+		                                   0.01189670994589177,  0.01041126526197209,  0.009255462182712733,
+		                                   0.008330563433362871};
+		if (k < 10) {
+			return table[idx_t(k)];
+		}
+		const double inv_k1 = 1 / (k + 1);
+		const double inv_k1_sq = inv_k1 * inv_k1;
+		return (1.0 / 12 - (1.0 / 360 - (1.0 / 1260) * inv_k1_sq) * inv_k1_sq) * inv_k1;
+	}
+
+	// One attempt from three uniforms; returns false when the candidate is rejected.
+	bool Attempt(double v, double u2, double u3, double &k) const {
+		double u;
+		if (v <= u_rv_r) {
+			u = v / v_r - 0.43;
+			k = std::floor((2 * a / (0.5 - std::fabs(u)) + b) * u + c);
+			return true;
+		}
+		if (v >= v_r) {
+			u = u2 - 0.5;
+		} else {
+			u = v / v_r - 0.93;
+			u = std::copysign(0.5, u) - u;
+			v = u3 * v_r;
+		}
+		const double us = 0.5 - std::fabs(u);
+		k = std::floor((2 * a / us + b) * u + c);
+		if (k < 0 || k > n) {
+			return false;
+		}
+		v = v * alpha / (a / (us * us) + b);
+		const double km = std::fabs(k - m);
+		if (km <= 15) {
+			// Ratio f(k) / f(m) by the recurrence of the probability mass function.
+			double f = 1;
+			for (double i = m + 1; i <= k; i++) {
+				f *= nr / i - r;
+			}
+			for (double i = k + 1; i <= m; i++) {
+				v *= nr / i - r;
+			}
+			return v <= f;
+		}
+		const double log_v = std::log(v);
+		const double rho = (km / npq) * (((km / 3 + 0.625) * km + 1.0 / 6) / npq + 0.5);
+		const double t = -km * km / (2 * npq);
+		if (log_v < t - rho) {
+			return true;
+		}
+		if (log_v > t + rho) {
+			return false;
+		}
+		const double nm = n - m + 1;
+		const double h = (m + 0.5) * std::log((m + 1) / (r * nm)) + StirlingCorrection(m) + StirlingCorrection(n - m);
+		const double nk = n - k + 1;
+		return log_v <= h + (n + 1) * std::log(nm / nk) + (k + 0.5) * std::log(nk * r / (k + 1)) -
+		                    StirlingCorrection(k) - StirlingCorrection(n - k);
+	}
+};
+
+template <typename IntType = int64_t>
+struct poisson_sampler : public batch_sampler {
+	using result_type = IntType;
+
+	static void SampleBatch(idx_t count, const double *rate, double *out) {
+		double uniforms[STANDARD_VECTOR_SIZE];
+		sel_t large[STANDARD_VECTOR_SIZE];
+		idx_t large_count = 0;
+		InversionTable table;
+		double table_rate = -1;
+
+		FillUniformOpen01(uniforms, count);
+		for (idx_t i = 0; i < count; i++) {
+			if (rate[i] >= POISSON_PTRS_MIN_RATE) {
+				large[large_count++] = sel_t(i);
+				continue;
+			}
+			if (rate[i] != table_rate) {
+				table.BuildPoisson(rate[i]);
+				table_rate = rate[i];
+			}
+			out[i] = table.Find(uniforms[i]);
+		}
+		SamplePoissonPTRS(large_count, large, rate, out);
+	}
+};
+
+template <typename IntType = int64_t>
+struct binomial_sampler : public batch_sampler {
+	using result_type = IntType;
+
+	static void SampleBatch(idx_t count, const double *trials, const double *prob, double *out) {
+		double uniforms[STANDARD_VECTOR_SIZE];
+		sel_t large[STANDARD_VECTOR_SIZE];
+		idx_t large_count = 0;
+		InversionTable table;
+		double table_trials = -1;
+		double table_prob = -1;
+
+		// Both algorithms sample with p <= 0.5; larger p are reflected as n - X(n, 1 - p).
+		FillUniformOpen01(uniforms, count);
+		for (idx_t i = 0; i < count; i++) {
+			const double p = std::min(prob[i], 1 - prob[i]);
+			if (trials[i] * p >= BINOMIAL_BTRD_MIN_MEAN) {
+				large[large_count++] = sel_t(i);
+				continue;
+			}
+			if (trials[i] != table_trials || p != table_prob) {
+				table.BuildBinomial(trials[i], p);
+				table_trials = trials[i];
+				table_prob = p;
+			}
+			const double k = table.Find(uniforms[i]);
+			out[i] = prob[i] > 0.5 ? trials[i] - k : k;
+		}
+		if (large_count == 0) {
+			return;
+		}
+
+		double u2[STANDARD_VECTOR_SIZE];
+		double u3[STANDARD_VECTOR_SIZE];
+		// The setup is only redone when the parameters change, so once for constant parameters.
+		BinomialBTRD btrd(trials[large[0]], std::min(prob[large[0]], 1 - prob[large[0]]));
+		idx_t pending_count = large_count;
+		while (pending_count > 0) {
+			FillUniformOpen01(uniforms, pending_count);
+			FillUniformOpen01(u2, pending_count);
+			FillUniformOpen01(u3, pending_count);
+			idx_t retry_count = 0;
+			for (idx_t j = 0; j < pending_count; j++) {
+				const auto row = large[j];
+				const bool reflect = prob[row] > 0.5;
+				const double p = reflect ? 1 - prob[row] : prob[row];
+				if (trials[row] != btrd.n || p != btrd.p) {
+					btrd = BinomialBTRD(trials[row], p);
+				}
+				double k;
+				const bool accept = btrd.Attempt(uniforms[j], u2[j], u3[j], k);
+				out[row] = reflect ? trials[row] - k : k;
+				large[retry_count] = row;
+				retry_count += !accept;
+			}
+			pending_count = retry_count;
+		}
+	}
+};
+
+// The hypergeometric reduced as in Kachitvichyanukul and Schmeiser: the sample counts the n1
+// items of the smaller group among k = min(draws, total - draws) items, the drawn ones or the
+// ones left, so its support starts at 0 and its mode is at most half the group. Restore maps
+// such a count back to the number of defective items drawn.
+struct HypergeometricReduction {
+	double defective, draws, total, n1, n2, k;
+	bool swap, complement;
+
+	HypergeometricReduction(double defective, double draws, double total)
+	    : defective(defective), draws(draws), total(total) {
+		swap = defective + defective > total;
+		complement = draws + draws > total;
+		n1 = swap ? total - defective : defective;
+		n2 = total - n1;
+		k = complement ? total - draws : draws;
+	}
+
+	double Mode() const {
+		return std::floor((k + 1) * (n1 + 1) / (total + 2));
+	}
+
+	double Restore(double x) const {
+		if (complement) {
+			return swap ? draws - n1 + x : defective - x;
+		}
+		return swap ? draws - x : x;
+	}
+};
+
+// Hypergeometric variates for a reduced mode of at least HYPERGEOMETRIC_H2PE_MIN_MODE by the H2PE
+// algorithm of Kachitvichyanukul and Schmeiser: a hat made of a rectangle around the mode and two
+// exponential tails, with squeezes from Stirling bounds ahead of the exact test. Smaller modes
+// are sampled by inversion, which needs only a few terms of the pmf there.
+static constexpr double HYPERGEOMETRIC_H2PE_MIN_MODE = 10;
+
+struct HypergeometricH2PE {
+	static constexpr double DELTA_L = 0.0078;
+	static constexpr double DELTA_U = 0.0034;
+
+	double n1, n2, k, m, last, xl, xr, a, lambda_l, lambda_r, p1, p2, p3;
+
+	HypergeometricH2PE(double n1, double n2, double k) : n1(n1), n2(n2), k(k) {
+		const double total = n1 + n2;
+		m = std::floor((k + 1) * (n1 + 1) / (total + 2));
+		last = std::min(n1, k);
+		const double s = std::sqrt((total - k) * k * n1 * n2 / (total - 1) / total / total);
+		const double d = std::floor(1.5 * s) + 0.5;
+		xl = m - d + 0.5;
+		xr = m + d + 0.5;
+		a = LogWeight(m);
+		const double kl = std::exp(a - LogWeight(xl));
+		const double kr = std::exp(a - LogWeight(xr - 1));
+		lambda_l = -std::log(xl * (n2 - k + xl) / (n1 - xl + 1) / (k - xl + 1));
+		lambda_r = -std::log((n1 - xr + 1) * (k - xr + 1) / xr / (n2 - k + xr));
+		p1 = d + d;
+		p2 = p1 + kl / lambda_l;
+		p3 = p2 + kr / lambda_r;
+	}
+
+	// log(x! (n1 - x)! (k - x)! (n2 - k + x)!); the log pmf at x is a constant minus it.
+	double LogWeight(double x) const {
+		return std::lgamma(x + 1) + std::lgamma(n1 - x + 1) + std::lgamma(k - x + 1) + std::lgamma(n2 - k + x + 1);
+	}
+
+	// One attempt from two uniforms; returns false when the candidate is rejected.
+	bool Attempt(double u, double v, double &x) const {
+		u *= p3;
+		if (u < p1) {
+			x = std::floor(xl + u);
+		} else if (u <= p2) {
+			x = std::floor(xl + std::log(v) / lambda_l);
+			v *= (u - p1) * lambda_l;
+		} else {
+			x = std::floor(xr - std::log(v) / lambda_r);
+			v *= (u - p2) * lambda_r;
+		}
+		if (x < 0 || x > last) {
+			return false;
+		}
+		if (m < 100 || x <= 50) {
+			// Ratio f(x) / f(m) by the recurrence of the probability mass function.
+			double f = 1;
+			for (double i = m + 1; i <= x; i++) {
+				f *= (n1 - i + 1) * (k - i + 1) / ((n2 - k + i) * i);
+			}
+			for (double i = x + 1; i <= m; i++) {
+				f *= i * (n2 - k + i) / ((n1 - i + 1) * (k - i + 1));
+			}
+			return v <= f;
+		}
+
+		// Upper and lower bounds of log(f(x) / f(m)) from the Stirling series.
+		const double y1 = x + 1;
+		const double ym = x - m;
+		const double yn = n1 - x + 1;
+		const double yk = k - x + 1;
+		const double nk = n2 - k + y1;
+		const double r = -ym / y1;
+		const double s = ym / yn;
+		const double t = ym / yk;
+		const double e = -ym / nk;
+		const double g = yn * yk / (y1 * nk) - 1;
+		const double dg = g < 0 ? 1 + g : 1;
+		const double gu = g * (1 + g * (-0.5 + g / 3));
+		const double gl = gu - 0.25 * (g * g * g * g) / dg;
+		const double xm = m + 0.5;
+		const double xn = n1 - m + 0.5;
+		const double xk = k - m + 0.5;
+		const double nm = n2 - k + xm;
+		const double ub = x * gu - m * gl + DELTA_U + xm * r * (1 + r * (-0.5 + r / 3)) +
+		                  xn * s * (1 + s * (-0.5 + s / 3)) + xk * t * (1 + t * (-0.5 + t / 3)) +
+		                  nm * e * (1 + e * (-0.5 + e / 3));
+		const double log_v = std::log(v);
+		if (log_v > ub) {
+			return false;
+		}
+		auto fourth = [](double weight, double z) {
+			const double term = weight * (z * z * z * z);
+			return z < 0 ? term / (1 + z) : term;
+		};
+		const double spread = fourth(xm, r) + fourth(xn, s) + fourth(xk, t) + fourth(nm, e);
+		if (log_v < ub - 0.25 * spread + (x + m) * (gl - gu) - DELTA_L) {
+			return true;
+		}
+		return log_v <= a - LogWeight(x);
+	}
+};
+
+template <typename IntType = int64_t>
+struct hypergeometric_sampler : public batch_sampler {
+	using result_type = IntType;
+
+	static void SampleBatch(idx_t count, const double *defective, const double *draws, const double *total,
+	                        double *out) {
+		double uniforms[STANDARD_VECTOR_SIZE];
+		sel_t large[STANDARD_VECTOR_SIZE];
+		idx_t large_count = 0;
+		InversionTable table;
+		double table_n1 = -1;
+		double table_k = -1;
+		double table_total = -1;
+
+		FillUniformOpen01(uniforms, count);
+		for (idx_t i = 0; i < count; i++) {
+			const HypergeometricReduction reduced(defective[i], draws[i], total[i]);
+			if (reduced.Mode() >= HYPERGEOMETRIC_H2PE_MIN_MODE) {
+				large[large_count++] = sel_t(i);
+				continue;
+			}
+			if (reduced.n1 != table_n1 || reduced.k != table_k || reduced.total != table_total) {
+				table.BuildHypergeometric(reduced.n1, reduced.n2, reduced.k);
+				table_n1 = reduced.n1;
+				table_k = reduced.k;
+				table_total = reduced.total;
+			}
+			out[i] = reduced.Restore(table.Find(uniforms[i]));
+		}
+		if (large_count == 0) {
+			return;
+		}
+
+		double u2[STANDARD_VECTOR_SIZE];
+		// The setup is only redone when the parameters change, so once for constant parameters.
+		HypergeometricReduction reduced(defective[large[0]], draws[large[0]], total[large[0]]);
+		HypergeometricH2PE h2pe(reduced.n1, reduced.n2, reduced.k);
+		idx_t pending_count = large_count;
+		while (pending_count > 0) {
+			FillUniformOpen01(uniforms, pending_count);
+			FillUniformOpen01(u2, pending_count);
+			idx_t retry_count = 0;
+			for (idx_t j = 0; j < pending_count; j++) {
+				const auto row = large[j];
+				if (defective[row] != reduced.defective || draws[row] != reduced.draws || total[row] != reduced.total) {
+					reduced = HypergeometricReduction(defective[row], draws[row], total[row]);
+					h2pe = HypergeometricH2PE(reduced.n1, reduced.n2, reduced.k);
+				}
+				double x;
+				const bool accept = h2pe.Attempt(uniforms[j], u2[j], x);
+				out[row] = reduced.Restore(x);
+				large[retry_count] = row;
+				retry_count += !accept;
+			}
+			pending_count = retry_count;
+		}
+	}
+};
+
+// Zipf variates by the rejection-inversion of Hormann and Derflinger: k is proposed by inverting
+// the integral of the hat x^-s, and accepted unless u falls in the sliver between the hat and the
+// pmf. Nearly every attempt is accepted (above 98% for any n and s) and nothing is tabulated, so a
+// sample costs a few exp and log calls however many elements there are.
+struct ZipfRejectionInversion {
+	double n, s, h_integral_x1, h_integral_n, squeeze;
+
+	ZipfRejectionInversion(double n, double s) : n(n), s(s) {
+		using boost::math::detail::zipf_h_integral;
+		using boost::math::detail::zipf_h_integral_inverse;
+		h_integral_x1 = zipf_h_integral(1.5, s) - 1;
+		h_integral_n = zipf_h_integral(n + 0.5, s);
+		squeeze = 2 - zipf_h_integral_inverse(zipf_h_integral(2.5, s) - Weight(2), s);
+	}
+
+	// The pmf up to normalization, k^-s.
+	double Weight(double x) const {
+		return std::exp(-s * std::log(x));
+	}
+
+	// One attempt from a uniform; returns false when the candidate is rejected.
+	bool Attempt(double uniform, double &k) const {
+		using boost::math::detail::zipf_h_integral;
+		const double u = h_integral_n + uniform * (h_integral_x1 - h_integral_n);
+		const double x = boost::math::detail::zipf_h_integral_inverse(u, s);
+		k = std::min(std::max(std::floor(x + 0.5), 1.0), n);
+		return k - x <= squeeze || u >= zipf_h_integral(k + 0.5, s) - Weight(k);
+	}
+};
+
+template <typename IntType = int64_t>
+struct zipf_sampler : public batch_sampler {
+	using result_type = IntType;
+
+	static void SampleBatch(idx_t count, const double *elements, const double *exponent, double *out) {
+		if (count == 0) {
+			return;
+		}
+		double uniforms[STANDARD_VECTOR_SIZE];
+		sel_t pending[STANDARD_VECTOR_SIZE];
+		for (idx_t i = 0; i < count; i++) {
+			pending[i] = sel_t(i);
+		}
+		// The setup is only redone when the parameters change, so once for constant parameters.
+		ZipfRejectionInversion zipf(elements[0], exponent[0]);
+		idx_t pending_count = count;
+		while (pending_count > 0) {
+			FillUniformOpen01(uniforms, pending_count);
+			idx_t retry_count = 0;
+			for (idx_t j = 0; j < pending_count; j++) {
+				const auto row = pending[j];
+				if (elements[row] != zipf.n || exponent[row] != zipf.s) {
+					zipf = ZipfRejectionInversion(elements[row], exponent[row]);
+				}
+				double k;
+				const bool accept = zipf.Attempt(uniforms[j], k);
+				out[row] = k;
+				pending[retry_count] = row;
+				retry_count += !accept;
+			}
+			pending_count = retry_count;
+		}
+	}
+};
+
+// High 64 bits of the 128-bit product a * b.
+static inline uint64_t MultiplyHigh64(uint64_t a, uint64_t b) {
+#ifdef __SIZEOF_INT128__
+	return uint64_t((static_cast<unsigned __int128>(a) * b) >> 64);
+#else
+	const uint64_t a_low = a & 0xFFFFFFFF, a_high = a >> 32;
+	const uint64_t b_low = b & 0xFFFFFFFF, b_high = b >> 32;
+	const uint64_t low_low = a_low * b_low;
+	const uint64_t high_low = a_high * b_low;
+	const uint64_t low_high = a_low * b_high;
+	const uint64_t middle = (low_low >> 32) + (high_low & 0xFFFFFFFF) + low_high;
+	return a_high * b_high + (high_low >> 32) + (middle >> 32);
+#endif
+}
+
+// Lemire's nearly divisionless method for integers uniform on [lower, lower + range). The high
+// half of word * range is uniform unless the low half is below 2^w mod range, which is only
+// possible when the low half is below range itself; the modulo is computed for those rare
+// candidates only. A range of zero stands for the full 2^64 values.
+//
+// With CONSTANT_BOUNDS, lower and range point to a single value that the loops broadcast, so the
+// main loop is a multiply by a constant.
+template <bool CONSTANT_BOUNDS>
+struct UniformIntKernel {
+	// Ranges below 2^32: one 32-bit word per sample. The first loop has no branches and
+	// vectorizes (a 32 x 32 -> 64 bit multiply per lane); candidates whose low half fell below
+	// the range are rechecked afterwards.
+	static void Sample32(idx_t count, const int64_t *lower, const uint64_t *range, int64_t *out) {
+		uint32_t bits[STANDARD_VECTOR_SIZE];
+		uint32_t low[STANDARD_VECTOR_SIZE];
+		FillRandomBits(bits, count);
+		bool any_low = false;
+		for (idx_t i = 0; i < count; i++) {
+			const auto idx = CONSTANT_BOUNDS ? 0 : i;
+			const uint64_t product = uint64_t(bits[i]) * uint32_t(range[idx]);
+			out[i] = lower[idx] + int64_t(product >> 32);
+			low[i] = uint32_t(product);
+			any_low |= low[i] < uint32_t(range[idx]);
+		}
+		if (!any_low) {
+			return;
+		}
+		for (idx_t i = 0; i < count; i++) {
+			const auto idx = CONSTANT_BOUNDS ? 0 : i;
+			const auto s = uint32_t(range[idx]);
+			if (low[i] >= s) {
+				continue;
+			}
+			const uint32_t threshold = uint32_t(0u - s) % s;
+			while (low[i] < threshold) {
+				const uint64_t product = uint64_t(rng()) * s;
+				out[i] = lower[idx] + int64_t(product >> 32);
+				low[i] = uint32_t(product);
+			}
+		}
+	}
+
+	// Wider ranges: one 64-bit word per sample.
+	static void Sample64(idx_t count, const int64_t *lower, const uint64_t *range, int64_t *out) {
+		uint64_t words[STANDARD_VECTOR_SIZE];
+		FillRandomBits(words, count);
+		for (idx_t i = 0; i < count; i++) {
+			const auto idx = CONSTANT_BOUNDS ? 0 : i;
+			const uint64_t s = range[idx];
+			uint64_t word = words[i];
+			if (s != 0 && word * s < s) {
+				const uint64_t threshold = (uint64_t(0) - s) % s;
+				while (word * s < threshold) {
+					FillRandomBits(&word, 1);
+				}
+			}
+			const uint64_t offset = s == 0 ? word : MultiplyHigh64(word, s);
+			out[i] = int64_t(uint64_t(lower[idx]) + offset);
+		}
+	}
+};
+
+// Bounds are truncated to integers and inclusive, as boost::random::uniform_int_distribution.
+static inline void UniformIntBounds(double min, double max, int64_t &lower, uint64_t &range) {
+	lower = int64_t(min);
+	range = uint64_t(int64_t(max)) - uint64_t(lower) + 1;
+}
+
+// Ranges of at most 2^32 - 1 values take the 32-bit path.
+static inline bool UniformIntFits32(uint64_t range) {
+	return range - 1 < 0xFFFFFFFF;
+}
+
+template <typename IntType = int64_t>
+struct uniform_int_sampler : public batch_sampler {
+	using result_type = IntType;
+	using sample_type = int64_t;
+
+	static void SampleBatch(idx_t count, const double *min, const double *max, int64_t *out) {
+		int64_t lower[STANDARD_VECTOR_SIZE];
+		uint64_t range[STANDARD_VECTOR_SIZE];
+		bool fits32 = true;
+		for (idx_t i = 0; i < count; i++) {
+			UniformIntBounds(min[i], max[i], lower[i], range[i]);
+			fits32 &= UniformIntFits32(range[i]);
+		}
+		if (fits32) {
+			UniformIntKernel<false>::Sample32(count, lower, range, out);
+		} else {
+			UniformIntKernel<false>::Sample64(count, lower, range, out);
+		}
+	}
+
+	static void SampleConstant(idx_t count, double min, double max, int64_t *out) {
+		int64_t lower;
+		uint64_t range;
+		UniformIntBounds(min, max, lower, range);
+		if (UniformIntFits32(range)) {
+			UniformIntKernel<true>::Sample32(count, &lower, &range, out);
+		} else {
+			UniformIntKernel<true>::Sample64(count, &lower, &range, out);
+		}
+	}
+};
+
+// Bernoulli samples compare random bits against p scaled to an integer threshold, so a sample
+// never touches floating point. A p of k binary digits (0.5, 0.25, 0.375, ...) needs only k
+// random bits per sample and is cut out of 64-bit words; other values of p use one 32-bit word
+// per sample, the resolution of boost::random::bernoulli_distribution. DuckDB stores BOOLEAN
+// vectors one byte per row, so the bits are unpacked into the result as they are drawn.
+static constexpr int BERNOULLI_DYADIC_MAX_BITS = 8;
+
+// Number of binary digits of p if it has at most BERNOULLI_DYADIC_MAX_BITS of them, else zero.
+static inline int BernoulliDyadicBits(double p) {
+	for (int bits = 1; bits <= BERNOULLI_DYADIC_MAX_BITS; bits++) {
+		const double scaled = std::ldexp(p, bits);
+		if (scaled == std::floor(scaled)) {
+			return bits;
+		}
+	}
+	return 0;
+}
+
+static inline uint64_t BernoulliThreshold32(double p) {
+	return uint64_t(std::ldexp(p, 32));
+}
+
+template <typename BoolType = bool>
+struct bernoulli_sampler : public batch_sampler {
+	using result_type = BoolType;
+	using sample_type = bool;
+
+	static void SampleBatch(idx_t count, const double *p, bool *out) {
+		uint32_t bits[STANDARD_VECTOR_SIZE];
+		FillRandomBits(bits, count);
+		for (idx_t i = 0; i < count; i++) {
+			out[i] = bits[i] < BernoulliThreshold32(p[i]);
+		}
+	}
+
+	static void SampleConstant(idx_t count, double p, bool *out) {
+		if (p == 0 || p == 1) {
+			std::fill_n(out, count, p == 1);
+			return;
+		}
+		const int dyadic_bits = BernoulliDyadicBits(p);
+		if (dyadic_bits == 0) {
+			const uint64_t threshold = BernoulliThreshold32(p);
+			uint32_t bits[STANDARD_VECTOR_SIZE];
+			FillRandomBits(bits, count);
+			for (idx_t i = 0; i < count; i++) {
+				out[i] = bits[i] < threshold;
+			}
+			return;
+		}
+
+		const idx_t per_word = 64 / dyadic_bits;
+		const uint64_t mask = (uint64_t(1) << dyadic_bits) - 1;
+		const auto threshold = uint64_t(std::ldexp(p, dyadic_bits));
+		uint64_t words[STANDARD_VECTOR_SIZE];
+		FillRandomBits(words, (count + per_word - 1) / per_word);
+		for (idx_t i = 0; i < count; i++) {
+			const uint64_t digits = words[i / per_word] >> ((i % per_word) * dyadic_bits);
+			out[i] = (digits & mask) < threshold;
+		}
+	}
+};
+
+} // namespace duckdb
@@ -2,6 +2,8 @@
 #include "duckdb.hpp"
 #include <boost/random.hpp>
 #include "callable_traits.hpp"
+#include <tuple>
+#include <type_traits>
 
 namespace duckdb {
 
@@ -21,6 +23,13 @@ struct logical_type_map<double> {
 	}
 };
 
+template <>
+struct logical_type_map<float> {
+	static LogicalType Get() {
+		return LogicalType::FLOAT;
+	}
+};
+
 template <>
 struct logical_type_map<int64_t> {
 	static LogicalType Get() {
@@ -36,7 +45,67 @@ struct logical_type_map<std::pair<double, double>> {
 };
 
 // --- Distribution parameter traits ---
+// Each distribution's source file specializes these from its distribution_traits_base, which
+// gives the parameter types (param1_t, ...), param_names, prefix, LogicalParamTypes() and the two
+// parameter checks:
+// - ParametersValid(params...) is a branch-free predicate, its comparisons joined with &, so the
+//   executors can check a whole vector of rows in one loop. Non-finite parameters fail it unless
+//   the distribution accepts them, and NaNs always do, through a comparison or std::isfinite.
+// - ValidateParameters(params...) raises an InvalidInputException naming the first failed check.
+//   It raises for every parameter set ParametersValid rejects except those with NaNs, which
+//   RaiseInvalidParameters reports.
 template <typename Distribution>
 struct distribution_traits; // Primary template left undefined
 
+// Floating point parameters follow the real type of the distribution, integral ones (trial
+// counts and the like) keep their type.
+template <typename Param, typename Real>
+using rebind_real_t = std::conditional_t<std::is_floating_point_v<Param>, Real, Param>;
+
+// Traits for an instantiation of a distribution over another real type (e.g. float), derived
+// from the traits of the double instantiation. Validation is shared with the base traits.
+template <typename BaseTraits, typename Real, typename = void>
+struct real_distribution_traits : public BaseTraits {
+	using param1_t = rebind_real_t<typename BaseTraits::param1_t, Real>;
+	using return_t = rebind_real_t<typename BaseTraits::return_t, Real>;
+
+	static std::vector<LogicalType> LogicalParamTypes() {
+		return {logical_type_map<param1_t>::Get()};
+	}
+};
+
+template <typename BaseTraits, typename Real>
+struct real_distribution_traits<BaseTraits, Real, std::void_t<typename BaseTraits::param2_t>> : public BaseTraits {
+	using param1_t = rebind_real_t<typename BaseTraits::param1_t, Real>;
+	using param2_t = rebind_real_t<typename BaseTraits::param2_t, Real>;
+	using return_t = rebind_real_t<typename BaseTraits::return_t, Real>;
+
+	static std::vector<LogicalType> LogicalParamTypes() {
+		return {logical_type_map<param1_t>::Get(), logical_type_map<param2_t>::Get()};
+	}
+};
+
+// The parameter types of a distribution as a std::tuple, in the order of its param_names. The
+// parameter executors in utils.hpp expand it, so a family's arity is set by its traits alone.
+template <typename Traits, size_t PARAM_COUNT = Traits::param_names.size()>
+struct distribution_param_types;
+
+template <typename Traits>
+struct distribution_param_types<Traits, 1> {
+	using type = std::tuple<typename Traits::param1_t>;
+};
+
+template <typename Traits>
+struct distribution_param_types<Traits, 2> {
+	using type = std::tuple<typename Traits::param1_t, typename Traits::param2_t>;
+};
+
+template <typename Traits>
+struct distribution_param_types<Traits, 3> {
+	using type = std::tuple<typename Traits::param1_t, typename Traits::param2_t, typename Traits::param3_t>;
+};
+
+template <typename Distribution>
+using distribution_param_types_t = typename distribution_param_types<distribution_traits<Distribution>>::type;
+
 } // namespace duckdb
\ No newline at end of file
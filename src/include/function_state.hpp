@@ -0,0 +1,91 @@
+#pragma once
+#include "duckdb.hpp"
+#include "duckdb/execution/expression_executor_state.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include <boost/math/policies/policy.hpp>
+
+namespace duckdb {
+
+// Name of the setting selecting how accurately the boost::math functions are evaluated.
+constexpr const char *STOCHASTIC_PRECISION_SETTING = "stochastic_precision";
+
+enum class StochasticPrecision : uint8_t {
+	// Default boost::math policy: full double precision, internal promotion to long double,
+	// exceptions on domain and overflow errors.
+	FULL,
+	// About 1e-9 relative accuracy, no promotion to long double, errors reported as NaN/inf.
+	FAST
+};
+
+// Name of the setting selecting what happens to rows with invalid distribution parameters.
+constexpr const char *STOCHASTIC_ERROR_MODE_SETTING = "stochastic_error_mode";
+
+enum class StochasticErrorMode : uint8_t {
+	// Invalid parameters raise an InvalidInputException and abort the query.
+	RAISE,
+	// Rows with invalid parameters produce NULL.
+	RETURN_NULL
+};
+
+// Policy used by the fast instantiations of the boost::math distributions.
+using fast_precision_policy = boost::math::policies::policy<
+    boost::math::policies::promote_float<false>, boost::math::policies::promote_double<false>,
+    boost::math::policies::digits2<30>, boost::math::policies::domain_error<boost::math::policies::errno_on_error>,
+    boost::math::policies::pole_error<boost::math::policies::errno_on_error>,
+    boost::math::policies::overflow_error<boost::math::policies::errno_on_error>,
+    boost::math::policies::evaluation_error<boost::math::policies::errno_on_error>>;
+
+class StochasticCache;
+class StochasticStats;
+struct StochasticFunctionCounters;
+
+// Local state attached to every scalar function registered by this extension, created once
+// per thread for each expression.
+struct StochasticFunctionLocalState : public FunctionLocalState {
+	StochasticFunctionLocalState(idx_t function_id, StochasticPrecision precision, StochasticErrorMode error_mode,
+	                             idx_t cache_size)
+	    : function_id(function_id), precision(precision), error_mode(error_mode), cache_size(cache_size) {
+	}
+
+	// Id used to look up the statistics counters of the function.
+	idx_t function_id;
+	// Value of stochastic_precision when the query started.
+	StochasticPrecision precision;
+	// Value of stochastic_error_mode when the query started.
+	StochasticErrorMode error_mode;
+	// Value of stochastic_cache_size when the query started.
+	idx_t cache_size;
+	// The database's table cache, resolved on first use; see GetStochasticCache.
+	shared_ptr<StochasticCache> cache;
+	// The database's statistics and this state's counters in them, attached on first use; see
+	// StochasticStats::LocalCounters.
+	shared_ptr<StochasticStats> stats;
+	optional_ptr<StochasticFunctionCounters> counters;
+
+	~StochasticFunctionLocalState() override;
+
+	static unique_ptr<FunctionLocalState> Init(ExpressionState &state, const BoundFunctionExpression &expr,
+	                                           FunctionData *bind_data);
+
+	static optional_ptr<StochasticFunctionLocalState> Get(ExpressionState &state) {
+		auto local_state = ExecuteFunctionState::GetFunctionState(state);
+		if (!local_state) {
+			return nullptr;
+		}
+		return &local_state->Cast<StochasticFunctionLocalState>();
+	}
+
+	static bool UseFastPrecision(ExpressionState &state) {
+		auto local_state = Get(state);
+		return local_state && local_state->precision == StochasticPrecision::FAST;
+	}
+
+	static bool NullOnInvalid(ExpressionState &state) {
+		auto local_state = Get(state);
+		return local_state && local_state->error_mode == StochasticErrorMode::RETURN_NULL;
+	}
+};
+
+void LoadStochasticSettings(ExtensionLoader &loader);
+
+} // namespace duckdb
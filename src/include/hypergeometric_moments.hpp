@@ -0,0 +1,21 @@
+#pragma once
+#include <boost/math/distributions/hypergeometric.hpp>
+
+// boost::math forms the mean of the hypergeometric distribution as defective * sample_count in
+// unsigned arithmetic, which wraps once the product passes 2^32 (a million defective items among
+// three million drawn, say). The executors call mean(dist) unqualified with a dependent argument,
+// so argument-dependent lookup finds this overload at the point of instantiation, in namespace
+// boost::math with the distribution, and partial ordering then prefers it to boost's template
+// as the more specialized of the two. Declaration order does not matter, but a translation unit
+// instantiating them for the hypergeometric distribution must include this header.
+
+namespace boost {
+namespace math {
+
+template <class Policy>
+inline double mean(const hypergeometric_distribution<double, Policy> &dist) {
+	return double(dist.defective()) * double(dist.sample_count()) / double(dist.total());
+}
+
+} // namespace math
+} // namespace boost
@@ -0,0 +1,208 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <boost/math/constants/constants.hpp>
+
+namespace duckdb {
+
+// The functions the transforms are built from, in 'full' precision: the C library's.
+struct LibraryTransformMath {
+	static inline double Log(double x) {
+		return std::log(x);
+	}
+	static inline double Pow(double x, double y) {
+		return std::pow(x, y);
+	}
+	// tan(pi v) for v in (-0.5, 0.5).
+	static inline double TanPi(double v) {
+		return std::tan(boost::math::constants::pi<double>() * v);
+	}
+};
+
+// The same functions for stochastic_precision 'fast', as straight-line arithmetic on the bits of
+// the argument: the library calls keep the transform loops scalar, these let them vectorize.
+// They are accurate to a few ulps (Pow to about |y log x| ulps) for the arguments the transforms
+// produce: Log and Pow take finite positive normal x, which every transform of a uniform on (0, 1)
+// is, and TanPi takes v in (-0.5, 0.5).
+struct FastTransformMath {
+	static inline double FromBits(uint64_t bits) {
+		double value;
+		std::memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+	static inline uint64_t ToBits(double value) {
+		uint64_t bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+	static constexpr uint64_t SIGN_BIT = uint64_t(1) << 63;
+
+	// if_true where mask is all ones, if_false where it is zero.
+	static inline double Select(uint64_t mask, double if_true, double if_false) {
+		return FromBits((ToBits(if_true) & mask) | (ToBits(if_false) & ~mask));
+	}
+
+	// Only unsigned 64-bit adds and shifts below, which SSE2 has; converting between int64_t and
+	// double has no vector instruction before AVX-512, so integers go through 2^52 + i instead.
+	static inline double Log(double x) {
+		// x = 2^k m with m in [sqrt(1/2), sqrt(2)): the exponent field of x scaled by sqrt(2) is
+		// k + 1023, and m keeps the bits of x below it.
+		const uint64_t bits = ToBits(x);
+		const uint64_t biased_k = (bits + (0x3FF0000000000000ULL - 0x3FE6A09E667F3BCDULL)) >> 52;
+		const double m = FromBits(bits - (biased_k << 52) + (uint64_t(1023) << 52));
+		const double k = FromBits(0x4330000000000000ULL | biased_k) - (4503599627370496.0 + 1023);
+		// log(m) = 2 atanh(s) with s = (m - 1) / (m + 1), |s| < 0.172: the odd series up to s^19.
+		const double s = (m - 1) / (m + 1);
+		const double s2 = s * s;
+		double series = 1.0 / 19;
+		for (int n = 17; n >= 1; n -= 2) {
+			series = series * s2 + 1.0 / n;
+		}
+		return k * boost::math::constants::ln_two<double>() + 2 * s * series;
+	}
+
+	static inline double Exp(double x) {
+		// Beyond +-1400 the result is 0 or inf either way; the clamp keeps the scale factors in range.
+		const uint64_t beyond = uint64_t(0) - ((ToBits(1400.0) - (ToBits(x) & ~SIGN_BIT)) >> 63);
+		x = Select(beyond, std::copysign(1400.0, x), x);
+		// x = n log(2) + r with |r| <= log(2) / 2. Adding 1.5 * 2^52 rounds n and leaves 2^51 + n in
+		// the low bits; the two-part log(2) keeps n log(2) exact.
+		constexpr double SHIFT = 6755399441055744.0;
+		constexpr double LN2_HIGH = 6.93147180369123816490e-01;
+		constexpr double LN2_LOW = 1.90821492927058770002e-10;
+		const double shifted = x * boost::math::constants::log2_e<double>() + SHIFT;
+		const double n = shifted - SHIFT;
+		const double r = (x - n * LN2_HIGH) - n * LN2_LOW;
+		double series = 1;
+		for (int i = 13; i >= 1; i--) {
+			series = 1 + r * series * (1.0 / i);
+		}
+		// 2^n in two factors 2^h and 2^(n - h), h = floor(n / 2), each a normal double, so results
+		// near the ends of the range neither overflow early nor lose their subnormal digits.
+		const uint64_t biased_n = ToBits(shifted) & 0xFFFFFFFFFFFFFULL;
+		const uint64_t biased_h = biased_n >> 1;
+		const double low_scale = FromBits((biased_h - (uint64_t(1) << 50) + 1023) << 52);
+		const double high_scale = FromBits((biased_n - biased_h - (uint64_t(1) << 50) + 1023) << 52);
+		return series * low_scale * high_scale;
+	}
+
+	static inline double Pow(double x, double y) {
+		return Exp(y * Log(x));
+	}
+
+	static inline double TanPi(double v) {
+		// tan(pi a) = 1 / tan(pi (0.5 - a)), and 0.5 - a is exact, so the sine and cosine series
+		// only see arguments up to pi / 4 and the result stays accurate next to the poles. The
+		// choice is a bit mask rather than a conditional, which -ftrapping-math keeps as a branch.
+		const double a = std::fabs(v);
+		const uint64_t reflect = uint64_t(0) - ((ToBits(0.25) - ToBits(a)) >> 63);
+		const double t = boost::math::constants::pi<double>() * Select(reflect, 0.5 - a, a);
+		const double t2 = t * t;
+		double sine = 1;
+		double cosine = 1;
+		for (int n = 8; n >= 1; n--) {
+			sine = 1 - t2 * sine * (1.0 / ((2 * n) * (2 * n + 1)));
+			cosine = 1 - t2 * cosine * (1.0 / ((2 * n - 1) * (2 * n)));
+		}
+		sine *= t;
+		return std::copysign(Select(reflect, cosine, sine) / Select(reflect, sine, cosine), v);
+	}
+};
+
+// Samplers for the distributions whose inverse CDF has a closed form. Each one maps a uniform
+// variate u on (0, 1) to a sample, so a chunk is drawn by filling a buffer of uniforms and
+// applying Transform over it in one loop (see DistributionSampleInverseTransform). Transform
+// takes the math functions as LibraryTransformMath or FastTransformMath, chosen by
+// stochastic_precision. They take their parameters in the same order as the boost::math
+// distribution of their file and replace the boost::random distributions as SAMPLE_DISTRIBUTION.
+struct inverse_transform_sampler {};
+
+template <typename T>
+constexpr bool is_inverse_transform_sampler_v = std::is_base_of_v<inverse_transform_sampler, T>;
+
+template <typename RealType = double>
+struct exponential_sampler : public inverse_transform_sampler {
+	using result_type = RealType;
+
+	template <typename Math>
+	static inline double Transform(double u, double lambda) {
+		return -Math::Log(u) / lambda;
+	}
+};
+
+template <typename RealType = double>
+struct cauchy_sampler : public inverse_transform_sampler {
+	using result_type = RealType;
+
+	template <typename Math>
+	static inline double Transform(double u, double location, double scale) {
+		return location + scale * Math::TanPi(u - 0.5);
+	}
+};
+
+template <typename RealType = double>
+struct logistic_sampler : public inverse_transform_sampler {
+	using result_type = RealType;
+
+	template <typename Math>
+	static inline double Transform(double u, double location, double scale) {
+		return location + scale * Math::Log(u / (1 - u));
+	}
+};
+
+template <typename RealType = double>
+struct laplace_sampler : public inverse_transform_sampler {
+	using result_type = RealType;
+
+	// Uses u for both the side and the magnitude: |u - 0.5| * 2 is itself uniform on (0, 1).
+	template <typename Math>
+	static inline double Transform(double u, double location, double scale) {
+		const double centered = u - 0.5;
+		return location - std::copysign(scale, centered) * Math::Log(1 - 2 * std::fabs(centered));
+	}
+};
+
+template <typename RealType = double>
+struct weibull_sampler : public inverse_transform_sampler {
+	using result_type = RealType;
+
+	template <typename Math>
+	static inline double Transform(double u, double shape, double scale) {
+		return scale * Math::Pow(-Math::Log(u), 1 / shape);
+	}
+};
+
+template <typename RealType = double>
+struct rayleigh_sampler : public inverse_transform_sampler {
+	using result_type = RealType;
+
+	template <typename Math>
+	static inline double Transform(double u, double sigma) {
+		return sigma * std::sqrt(-2 * Math::Log(u));
+	}
+};
+
+template <typename RealType = double>
+struct pareto_sampler : public inverse_transform_sampler {
+	using result_type = RealType;
+
+	template <typename Math>
+	static inline double Transform(double u, double scale, double shape) {
+		return scale * Math::Pow(u, -1 / shape);
+	}
+};
+
+// Gumbel (maximum) distribution, as boost::math::extreme_value_distribution.
+template <typename RealType = double>
+struct extreme_value_sampler : public inverse_transform_sampler {
+	using result_type = RealType;
+
+	template <typename Math>
+	static inline double Transform(double u, double location, double scale) {
+		return location - scale * Math::Log(-Math::Log(u));
+	}
+};
+
+} // namespace duckdb
@@ -0,0 +1,140 @@
+#pragma once
+#include "utils.hpp"
+#include <cmath>
+
+namespace duckdb {
+
+// Standard normal quantile by Wichura's algorithm AS 241 (PPND16), accurate to about 1e-16.
+// The central rational function covers 0.075 <= p <= 0.925; the tails work in
+// r = sqrt(-log(min(p, 1 - p))) with one rational function for r <= 5 and one beyond.
+// Coefficients are listed from the constant term up.
+static constexpr double AS241_CENTRAL_NUMERATOR[] = {
+    3.387132872796366608, 133.14166789178437745, 1971.5909503065514427, 13731.693765509461125, 45921.953931549871457,
+    67265.770927008700853, 33430.575583588128105, 2509.0809287301226727};
+static constexpr double AS241_CENTRAL_DENOMINATOR[] = {
+    1.0, 42.313330701600911252, 687.1870074920579083, 5394.1960214247511077, 21213.794301586595867,
+    39307.89580009271061, 28729.085735721942674, 5226.495278852545925};
+static constexpr double AS241_NEAR_TAIL_NUMERATOR[] = {
+    1.42343711074968357734, 4.6303378461565452959, 5.7694972214606914055, 3.64784832476320460504,
+    1.27045825245236838258, 0.24178072517745061177, 0.0227238449892691845833, 7.7454501427834140764e-4};
+static constexpr double AS241_NEAR_TAIL_DENOMINATOR[] = {
+    1.0, 2.05319162663775882187, 1.6763848301838038494, 0.68976733498510000455, 0.14810397642748007459,
+    0.0151986665636164571966, 5.475938084995344946e-4, 1.05075007164441684324e-9};
+static constexpr double AS241_FAR_TAIL_NUMERATOR[] = {
+    6.6579046435011037772, 5.4637849111641143699, 1.7848265399172913358, 0.29656057182850489123,
+    0.026532189526576123093, 0.0012426609473880784386, 2.71155556874348757815e-5, 2.01033439929228813265e-7};
+static constexpr double AS241_FAR_TAIL_DENOMINATOR[] = {
+    1.0, 0.59983220655588793769, 0.13692988092273580531, 0.0148753612908506148525, 7.868691311456132591e-4,
+    1.8463183175100546818e-5, 1.4215117583164458887e-7, 2.04426310338993978564e-15};
+
+template <size_t N>
+static inline double EvaluateRational(const double (&numerator)[N], const double (&denominator)[N], double x) {
+	double num = numerator[N - 1];
+	double den = denominator[N - 1];
+	for (size_t k = N - 1; k > 0; k--) {
+		num = num * x + numerator[k - 1];
+		den = den * x + denominator[k - 1];
+	}
+	return num / den;
+}
+
+// Valid for |p - 0.5| <= 0.425, takes q = p - 0.5.
+static inline double StandardNormalQuantileCentral(double q) {
+	return q * EvaluateRational(AS241_CENTRAL_NUMERATOR, AS241_CENTRAL_DENOMINATOR, 0.180625 - q * q);
+}
+
+static inline double StandardNormalQuantileTail(double p) {
+	const double q = p - 0.5;
+	const double r = std::sqrt(-std::log(q < 0 ? p : 1 - p));
+	const double value = r <= 5 ? EvaluateRational(AS241_NEAR_TAIL_NUMERATOR, AS241_NEAR_TAIL_DENOMINATOR, r - 1.6)
+	                            : EvaluateRational(AS241_FAR_TAIL_NUMERATOR, AS241_FAR_TAIL_DENOMINATOR, r - 5);
+	return q < 0 ? -value : value;
+}
+
+// A single quantile, taking the same branch as the batch below; p must be in (0, 1).
+static inline double StandardNormalQuantile(double p) {
+	const double q = p - 0.5;
+	return std::fabs(q) <= 0.425 ? StandardNormalQuantileCentral(q) : StandardNormalQuantileTail(p);
+}
+
+// Evaluates the central rational function for every row in one branch-free loop, which the
+// compiler vectorizes, then recomputes the rows that fall in the tails.
+static inline void StandardNormalQuantileBatch(idx_t count, const double *p, double *out) {
+	bool any_tail = false;
+	for (idx_t i = 0; i < count; i++) {
+		const double q = p[i] - 0.5;
+		out[i] = StandardNormalQuantileCentral(q);
+		any_tail |= std::fabs(q) > 0.425;
+	}
+	if (!any_tail) {
+		return;
+	}
+	for (idx_t i = 0; i < count; i++) {
+		if (std::fabs(p[i] - 0.5) > 0.425) {
+			out[i] = StandardNormalQuantileTail(p[i]);
+		}
+	}
+}
+
+// Quantile functions of the distributions that are a transform of the standard normal (the
+// normal and the lognormal). The standard normal quantiles of the p column are computed in
+// one batch, then op(dist, z) maps them through DistributionCallUnary, which treats the
+// parameter columns as for any other function. Returns false, leaving the result untouched,
+// when some p is outside (0, 1); the caller then evaluates with boost::math, which raises or
+// returns NaN and infinities as stochastic_precision asks.
+template <typename DistributionType, typename Func>
+bool NormalQuantileBatch(DataChunk &args, ExpressionState &state, Vector &result, Func op) {
+	constexpr idx_t PARAM_COUNT = distribution_traits<DistributionType>::param_names.size();
+	const idx_t count = args.size();
+	auto &p_vector = args.data[PARAM_COUNT];
+	const bool constant_p = p_vector.GetVectorType() == VectorType::CONSTANT_VECTOR;
+	const idx_t p_count = constant_p ? 1 : count;
+
+	UnifiedVectorFormat p_data;
+	p_vector.ToUnifiedFormat(count, p_data);
+	const auto p_entries = UnifiedVectorFormat::GetData<double>(p_data);
+
+	double p[STANDARD_VECTOR_SIZE];
+	bool in_domain = true;
+	for (idx_t i = 0; i < p_count; i++) {
+		const auto idx = p_data.sel->get_index(i);
+		p[i] = p_data.validity.RowIsValid(idx) ? p_entries[idx] : 0.5;
+		in_domain &= (p[i] > 0) & (p[i] < 1);
+	}
+	if (!in_domain) {
+		return false;
+	}
+
+	Vector z_vector(LogicalType::DOUBLE, p_count);
+	if (constant_p) {
+		z_vector.SetVectorType(VectorType::CONSTANT_VECTOR);
+		ConstantVector::SetNull(z_vector, ConstantVector::IsNull(p_vector));
+		StandardNormalQuantileBatch(1, p, ConstantVector::GetData<double>(z_vector));
+	} else {
+		StandardNormalQuantileBatch(p_count, p, FlatVector::GetData<double>(z_vector));
+		if (!p_data.validity.AllValid()) {
+			for (idx_t i = 0; i < p_count; i++) {
+				if (!p_data.validity.RowIsValid(p_data.sel->get_index(i))) {
+					FlatVector::SetNull(z_vector, i, true);
+				}
+			}
+		}
+	}
+
+	vector<LogicalType> quantile_types;
+	for (idx_t c = 0; c < PARAM_COUNT; c++) {
+		quantile_types.push_back(args.data[c].GetType());
+	}
+	quantile_types.push_back(LogicalType::DOUBLE);
+	DataChunk quantile_args;
+	quantile_args.InitializeEmpty(quantile_types);
+	for (idx_t c = 0; c < PARAM_COUNT; c++) {
+		quantile_args.data[c].Reference(args.data[c]);
+	}
+	quantile_args.data[PARAM_COUNT].Reference(z_vector);
+	quantile_args.SetCardinality(count);
+	DistributionCallUnary<DistributionType, double>(quantile_args, state, result, op);
+	return true;
+}
+
+} // namespace duckdb
@@ -0,0 +1,295 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <unordered_map>
+#include "utils.hpp"
+
+namespace duckdb {
+
+// The ratio pmf(k + 1) / pmf(k) of a discrete distribution, specialized next to its registrations.
+// With it a range of k costs one boost::math evaluation at an anchor and a multiplication per step.
+template <typename DistributionType>
+struct pmf_recurrence;
+
+// Largest kmax of pmf_range, so a list holds at most 2^24 values (128 MiB); a larger kmax would
+// otherwise allocate kmax + 1 doubles for a single row before any value is computed.
+static constexpr int64_t PMF_RANGE_MAX_KMAX = (int64_t(1) << 24) - 1;
+
+// Steps between anchors: each walk is re-anchored on boost::math this often, which bounds the
+// rounding error a long range accumulates to that of this many multiplications.
+static constexpr int64_t PMF_RECURRENCE_ANCHOR_INTERVAL = 256;
+
+// Smallest k of the support (the hypergeometric can start above 0), clamped to limit + 1.
+template <typename DistributionType>
+static inline int64_t PmfRangeFirst(const DistributionType &dist, int64_t limit) {
+	const double support_min = boost::math::support(dist).first;
+	return support_min > double(limit) ? limit + 1 : int64_t(support_min);
+}
+
+// Largest k of the support, clamped to limit (the binomial stops at its number of trials).
+template <typename DistributionType>
+static inline int64_t PmfRangeLast(const DistributionType &dist, int64_t limit) {
+	const double support_max = boost::math::support(dist).second;
+	return support_max < double(limit) ? int64_t(support_max) : limit;
+}
+
+// Writes pmf(k) for k = 0..kmax. The values are cut into blocks of PMF_RECURRENCE_ANCHOR_INTERVAL,
+// each walked from one boost::math anchor: blocks above the mode from their first value upwards,
+// blocks below it from their last value downwards (starting past kmax if need be), and the block
+// holding the mode both ways from the mode. Every step moves away from the mode, so it shrinks the
+// value, which underflows only where the pmf itself does. The anchors depend on the distribution
+// alone, so pmf(k) does not depend on kmax: a shorter range is bit for bit a prefix of a longer
+// one, and pmf_range gives the same values whether a row's table was cached or filled for it.
+// Outside the support the pmf is zero and boost::math is not called.
+template <typename DistributionType>
+static void FillPmfRange(const DistributionType &dist, int64_t kmax, double *out) {
+	using recurrence = pmf_recurrence<DistributionType>;
+	constexpr int64_t BLOCK = PMF_RECURRENCE_ANCHOR_INTERVAL;
+	const auto support = boost::math::support(dist);
+	const int64_t first = PmfRangeFirst(dist, kmax);
+	const int64_t last = PmfRangeLast(dist, kmax);
+	// The mode formulas divide by the probability, so it can be infinite or NaN at the edges. It is
+	// kept as a double, as it can be far beyond kmax.
+	const double mode = boost::math::mode(dist);
+	const double anchor = !(mode > support.first) ? support.first
+	                      : mode < support.second ? std::floor(mode)
+	                                              : support.second;
+
+	std::fill(out, out + kmax + 1, 0.0);
+	for (int64_t start = first - first % BLOCK; start <= last; start += BLOCK) {
+		const int64_t end = start + BLOCK - 1;
+		const int64_t low = std::max(start, first);
+		const int64_t high = std::min(end, last);
+		if (low > high) {
+			continue;
+		}
+		if (double(start) > anchor) {
+			out[start] = boost::math::pdf(dist, double(start));
+			for (int64_t k = start + 1; k <= high; k++) {
+				out[k] = out[k - 1] * recurrence::Ratio(dist, double(k - 1));
+			}
+			continue;
+		}
+		// The walk down starts at the block's last value, or at the mode in its block, which may
+		// both lie past kmax; only the values from high down are stored.
+		const int64_t top = double(end) < anchor ? end : int64_t(anchor);
+		double pmf = boost::math::pdf(dist, double(top));
+		if (top <= high) {
+			out[top] = pmf;
+			for (int64_t k = top + 1; k <= high; k++) {
+				out[k] = out[k - 1] * recurrence::Ratio(dist, double(k - 1));
+			}
+		}
+		for (int64_t k = top - 1; k >= low; k--) {
+			pmf /= recurrence::Ratio(dist, double(k));
+			if (k <= high) {
+				out[k] = pmf;
+			}
+		}
+	}
+}
+
+// dist_<name>_pmf_range(params..., kmax): the pmf at 0, 1, ..., kmax as a LIST(DOUBLE), filled by
+// FillPmfRange. Parameters are checked as for the other functions; a kmax outside
+// [0, PMF_RANGE_MAX_KMAX] raises, or gives NULL when stochastic_error_mode is 'null'. The rows of
+// a chunk are grouped by their parameters: each distinct parameter set gets one table, as long as
+// the largest kmax among its rows and looked up in the table cache once, and every row copies its
+// prefix. So parameters repeated across rows, as a fitted model's are, and across queries fill
+// their table once.
+template <typename DistributionType>
+inline void DistributionCallPmfRange(DataChunk &args, ExpressionState &state, Vector &result) {
+	using traits = distribution_traits<DistributionType>;
+	using ParamTuple = distribution_param_types_t<DistributionType>;
+
+	const idx_t count = args.size();
+	auto &kmax_vector = args.data[traits::param_names.size()];
+	StochasticStatsScope stats(state, count);
+
+	const bool constant_params = ConstantParameterVectors<DistributionType>(args);
+	const bool constant = constant_params && kmax_vector.GetVectorType() == VectorType::CONSTANT_VECTOR;
+	bool has_invalid_rows = false;
+	if (constant_params) {
+		if (constant) {
+			stats.ConstantPath();
+		} else {
+			stats.ConstantParamsPath();
+		}
+		if (!WithConstantParameters<DistributionType>(state, args, result, [](auto...) {})) {
+			return;
+		}
+	} else {
+		stats.PerRowPath();
+		has_invalid_rows = CheckParameterVectors<DistributionType>(state, args);
+	}
+
+	UnifiedVectorFormat kmax_data;
+	kmax_vector.ToUnifiedFormat(count, kmax_data);
+	auto kmax_entries = UnifiedVectorFormat::GetData<int64_t>(kmax_data);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto &result_validity = FlatVector::Validity(result);
+
+	struct Group {
+		ParamTuple params;
+		int64_t longest;
+		vector<double> table;
+	};
+	vector<Group> groups;
+	std::unordered_map<StochasticCacheKey, idx_t, StochasticCacheKeyHash> group_index;
+	// The group of each row, or INVALID_INDEX for a NULL row.
+	idx_t row_groups[STANDARD_VECTOR_SIZE];
+	const idx_t row_count = constant ? 1 : count;
+	DistributionColumns<DistributionType>(args, 0).ForEachRow(
+	    row_count,
+	    [&](idx_t i, auto... params) {
+		    row_groups[i] = DConstants::INVALID_INDEX;
+		    const auto kmax_index = kmax_data.sel->get_index(i);
+		    if (!kmax_data.validity.RowIsValid(kmax_index)) {
+			    result_validity.SetInvalid(i);
+			    return;
+		    }
+		    const auto kmax = kmax_entries[kmax_index];
+		    if (kmax < 0 || kmax > PMF_RANGE_MAX_KMAX) {
+			    if (!StochasticFunctionLocalState::NullOnInvalid(state)) {
+				    throw InvalidInputException(string(traits::prefix) + ": kmax must be in [0, " +
+				                                std::to_string(PMF_RANGE_MAX_KMAX) + "] was: " + std::to_string(kmax));
+			    }
+			    result_validity.SetInvalid(i);
+			    return;
+		    }
+		    if (has_invalid_rows && !traits::ParametersValid(params...)) {
+			    result_validity.SetInvalid(i);
+			    return;
+		    }
+		    auto key = MakeStochasticCacheKey(state);
+		    (key.Add(params), ...);
+		    const auto entry = group_index.emplace(std::move(key), groups.size());
+		    if (entry.second) {
+			    groups.push_back(Group {ParamTuple(params...), kmax, {}});
+		    }
+		    auto &group = groups[entry.first->second];
+		    group.longest = std::max(group.longest, kmax);
+		    row_groups[i] = entry.first->second;
+	    },
+	    [&](idx_t i) {
+		    row_groups[i] = DConstants::INVALID_INDEX;
+		    result_validity.SetInvalid(i);
+	    });
+
+	const auto cache = GetStochasticCache(state);
+	for (auto &entry : group_index) {
+		auto &group = groups[entry.second];
+		const idx_t length = idx_t(group.longest) + 1;
+		group.table.resize(length);
+		const auto dist = std::make_from_tuple<DistributionType>(group.params);
+		auto fill = [&](double *table) {
+			FillPmfRange(dist, group.longest, table);
+		};
+		if (cache) {
+			CachedTable(*cache, entry.first, length, group.table.data(), fill);
+		} else {
+			fill(group.table.data());
+		}
+	}
+
+	auto list_entries = FlatVector::GetData<list_entry_t>(result);
+	auto &values = ListVector::GetEntry(result);
+	idx_t offset = ListVector::GetListSize(result);
+	for (idx_t i = 0; i < row_count; i++) {
+		if (row_groups[i] == DConstants::INVALID_INDEX) {
+			continue;
+		}
+		const idx_t length = idx_t(kmax_entries[kmax_data.sel->get_index(i)]) + 1;
+		ListVector::Reserve(result, offset + length);
+		const auto &table = groups[row_groups[i]].table;
+		std::copy(table.begin(), table.begin() + length, FlatVector::GetData<double>(values) + offset);
+		list_entries[i] = list_entry_t(offset, length);
+		offset += length;
+	}
+	ListVector::SetListSize(result, offset);
+	if (constant) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+// The cdf over a non-decreasing run of integers x in the support of dist: each row adds the pmf
+// terms since the previous row, which pmf_recurrence advances, instead of evaluating the cdf again.
+// Gaps wider than the anchor interval, and a pmf below the normal range, from which the walk could
+// not recover, start a new walk from boost::math. Returns false for x in any other order.
+template <typename DistributionType>
+bool DiscreteCdfWalk(const DistributionType &dist, Vector &x_vector, idx_t count, ExpressionState &state,
+                     Vector &result) {
+	using recurrence = pmf_recurrence<DistributionType>;
+
+	UnifiedVectorFormat x_data;
+	x_vector.ToUnifiedFormat(count, x_data);
+	if (!x_data.validity.AllValid()) {
+		return false;
+	}
+	const auto x_entries = UnifiedVectorFormat::GetData<double>(x_data);
+	const auto support = boost::math::support(dist);
+	const double support_max = support.second;
+	// x below the support is left to boost::math, which raises for it with some distributions.
+	double previous = support.first;
+	for (idx_t i = 0; i < count; i++) {
+		const double x = x_entries[x_data.sel->get_index(i)];
+		// Also rejects NaN, which fails every comparison.
+		if (!(x >= previous && x <= support_max && x == std::floor(x))) {
+			return false;
+		}
+		previous = x;
+	}
+
+	StochasticStatsScope stats(state, count);
+	stats.ConstantParamsPath();
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	const auto results = FlatVector::GetData<double>(result);
+
+	// The walk is at k with pmf(k) and cdf(k); steps counts the multiplications since its anchor.
+	double k = -1;
+	double pmf = 0;
+	double cdf = 0;
+	int64_t steps = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const double x = x_entries[x_data.sel->get_index(i)];
+		if (k < 0 || x - k > double(PMF_RECURRENCE_ANCHOR_INTERVAL - steps)) {
+			k = x;
+			pmf = boost::math::pdf(dist, k);
+			cdf = boost::math::cdf(dist, k);
+			steps = pmf < std::numeric_limits<double>::min() ? PMF_RECURRENCE_ANCHOR_INTERVAL : 0;
+		}
+		for (; k < x; k++, steps++) {
+			pmf *= recurrence::Ratio(dist, k);
+			cdf += pmf;
+		}
+		results[i] = std::min(cdf, 1.0);
+	}
+	return true;
+}
+
+// The cdf of a discrete distribution over a chunk whose parameters are constant and whose x is a
+// non-decreasing run of integers, as range() or a sorted key column produce; see DiscreteCdfWalk.
+// Sums of positive terms keep their relative accuracy, so only the cdf and not its complement is
+// computed this way. Returns false, leaving the result untouched, for any other chunk (NULLs and
+// invalid parameters included); the caller then evaluates the chunk row by row.
+template <typename DistributionType>
+bool DiscreteCdfRange(DataChunk &args, ExpressionState &state, Vector &result) {
+	using traits = distribution_traits<DistributionType>;
+
+	auto &x_vector = args.data[traits::param_names.size()];
+	if (!ConstantParameterVectors<DistributionType>(args) || x_vector.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		return false;
+	}
+	bool walked = false;
+	DistributionColumns<DistributionType>(args, 0).ForEachRow(
+	    1,
+	    [&](idx_t, auto... params) {
+		    walked = traits::ParametersValid(params...) &&
+		             DiscreteCdfWalk(DistributionType(params...), x_vector, args.size(), state, result);
+	    },
+	    [](idx_t) {});
+	return walked;
+}
+
+} // namespace duckdb
@@ -1,10 +1,13 @@
 #pragma once
+#include "duckdb.hpp"
 #include <random>
 #include <unordered_map>
 #include <thread>
 #include <mutex>
 #include <vector>
 #include <boost/random/mersenne_twister.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <cmath>
 
 namespace duckdb {
 // Global seed for all RNG streams
@@ -25,4 +28,45 @@ static thread_local boost::random::mt19937 rng = [] {
 	return local_rng;
 }();
 
+// Fills `out` with `count` raw 32-bit random words, one generator call each.
+static inline void FillRandomBits(uint32_t *out, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		out[i] = rng();
+	}
+}
+
+// Fills `out` with `count` raw 64-bit random words, each made of two generator calls.
+static inline void FillRandomBits(uint64_t *out, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		const uint64_t high = rng();
+		out[i] = (high << 32) | rng();
+	}
+}
+
+// Fills `out` with `count` doubles uniform on the open interval (0, 1), each built from 53
+// random bits. Zero and one are excluded so inverse transforms can take logarithms freely.
+static inline void FillUniformOpen01(double *out, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		const uint64_t high = rng() >> 5;
+		const uint64_t low = rng() >> 6;
+		out[i] = (double((high << 26) | low) + 0.5) * (1.0 / 9007199254740992.0);
+	}
+}
+
+// Fills `out` with `count` standard normal variates by the Box–Muller transform, two per pair
+// of uniforms. `count` may be at most STANDARD_VECTOR_SIZE.
+static inline void FillStandardNormal(double *out, size_t count) {
+	double uniforms[STANDARD_VECTOR_SIZE + 1];
+	const size_t pairs = (count + 1) / 2;
+	FillUniformOpen01(uniforms, pairs * 2);
+	for (size_t i = 0; i < pairs; i++) {
+		const double radius = std::sqrt(-2 * std::log(uniforms[2 * i]));
+		const double angle = boost::math::constants::two_pi<double>() * uniforms[2 * i + 1];
+		out[2 * i] = radius * std::cos(angle);
+		if (2 * i + 1 < count) {
+			out[2 * i + 1] = radius * std::sin(angle);
+		}
+	}
+}
+
 }
\ No newline at end of file
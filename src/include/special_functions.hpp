@@ -0,0 +1,293 @@
+#pragma once
+#include "duckdb.hpp"
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <boost/math/constants/constants.hpp>
+
+namespace duckdb {
+
+// Regularized incomplete gamma and beta functions for the cdfs of the gamma, chi-squared,
+// beta, Student's t and Fisher F distributions, evaluated a chunk at a time (see
+// DistributionCallCdfKernel). The terms that depend only on the parameters are computed once
+// per run of rows with equal parameters, so once per chunk for constant parameters; only the
+// series or continued fraction is evaluated per row.
+//
+// The power prefactors x^a e^-x / Gamma(a) and x^a (1 - x)^b / B(a, b) are formed around the
+// mode with log1p and Stirling's series, which keeps them accurate to a few ulps for large
+// shapes. A row is left to boost::math when x is outside the kernel's domain, the series does
+// not converge, or the requested tail would be formed as 1 - t with t above 0.9.
+static constexpr int SPECIAL_FUNCTION_MAX_ITERATIONS = 1000;
+// Largest shapes evaluated here by the copula's Student's t marginals, which only need uniforms,
+// and by the cdf functions, which use the kernels only for stochastic_precision 'fast'. The error
+// of the prefactors grows with the shapes, to about 1e-13 relative at 100 and 1e-11 at 10^4.
+static constexpr double SPECIAL_FUNCTION_MAX_SHAPE = 100;
+static constexpr double SPECIAL_FUNCTION_FAST_MAX_SHAPE = 1e4;
+static constexpr double SPECIAL_FUNCTION_MIN_COMPLEMENT = 0.1;
+static constexpr double SPECIAL_FUNCTION_TINY = 1e-300;
+static constexpr double SPECIAL_FUNCTION_EPSILON = std::numeric_limits<double>::epsilon();
+
+// log Gamma(a) - ((a - 0.5) log a - a + 0.5 log(2 pi)), the error of Stirling's approximation.
+// Above 10 it is summed from its asymptotic series, whose terms below are in powers of 1 / a^2.
+static constexpr double STIRLING_SERIES[] = {1.0 / 12, -1.0 / 360, 1.0 / 1260, -1.0 / 1680, 1.0 / 1188,
+                                             -691.0 / 360360};
+
+static inline double StirlingError(double a) {
+	if (a < 10) {
+		return std::lgamma(a) - (a - 0.5) * std::log(a) + a - boost::math::constants::log_root_two_pi<double>();
+	}
+	const double inv2 = 1 / (a * a);
+	double sum = 0;
+	for (idx_t k = std::size(STIRLING_SERIES); k > 0; k--) {
+		sum = sum * inv2 + STIRLING_SERIES[k - 1];
+	}
+	return sum / a;
+}
+
+// r - 1 - log(r) for r = value / mode. Near the mode it is taken as d - log1p(d) with
+// d = (value - mode) / mode, far below it from the ratio itself, so neither form cancels.
+static inline double LogRatioDeviation(double value, double mode) {
+	const double d = (value - mode) / mode;
+	return d < -0.5 ? d - std::log(value / mode) : d - std::log1p(d);
+}
+
+// Turns a computed tail into the requested one. Returns false when the result is not finite
+// or 1 - tail would lose accuracy.
+static inline bool ComplementTail(double tail, bool tail_is_upper, bool upper, double &out) {
+	const bool complemented = tail_is_upper != upper;
+	out = complemented ? 1 - tail : tail;
+	return std::isfinite(out) && (!complemented || out >= SPECIAL_FUNCTION_MIN_COMPLEMENT);
+}
+
+// P(a, x) and Q(a, x) for one shape a.
+struct IncompleteGamma {
+	double a = std::numeric_limits<double>::quiet_NaN();
+	bool in_range = false;
+	// log(x^a e^-x / Gamma(a)) + a * LogRatioDeviation(x, a)
+	double log_scale = 0;
+
+	IncompleteGamma() = default;
+	IncompleteGamma(double a, double max_shape)
+	    : a(a), in_range(a <= max_shape),
+	      log_scale(0.5 * std::log(a / boost::math::constants::two_pi<double>()) - StirlingError(a)) {
+	}
+
+	// Sets out to Q(a, x) if upper, else P(a, x). Returns false if boost::math should be used.
+	bool Evaluate(double x, bool upper, double &out) const {
+		if (!in_range || !(x >= 0) || !std::isfinite(x)) {
+			return false;
+		}
+		if (x == 0) {
+			out = upper ? 1 : 0;
+			return true;
+		}
+		const double prefix = std::exp(log_scale - a * LogRatioDeviation(x, a));
+		if (x < a + 1) {
+			// Series for P: x^a e^-x / Gamma(a) * sum_n x^n / (a (a + 1) ... (a + n))
+			double term = 1 / a;
+			double sum = term;
+			for (int n = 1; n < SPECIAL_FUNCTION_MAX_ITERATIONS; n++) {
+				term *= x / (a + n);
+				sum += term;
+				if (term < sum * SPECIAL_FUNCTION_EPSILON) {
+					return ComplementTail(prefix * sum, false, upper, out);
+				}
+			}
+			return false;
+		}
+		// Continued fraction for Q, by the modified Lentz method.
+		double b = x + 1 - a;
+		double c = 1 / SPECIAL_FUNCTION_TINY;
+		double d = 1 / b;
+		double h = d;
+		for (int i = 1; i < SPECIAL_FUNCTION_MAX_ITERATIONS; i++) {
+			const double an = -i * (i - a);
+			b += 2;
+			d = an * d + b;
+			d = std::fabs(d) < SPECIAL_FUNCTION_TINY ? SPECIAL_FUNCTION_TINY : d;
+			c = b + an / c;
+			c = std::fabs(c) < SPECIAL_FUNCTION_TINY ? SPECIAL_FUNCTION_TINY : c;
+			d = 1 / d;
+			const double delta = d * c;
+			h *= delta;
+			if (std::fabs(delta - 1) < SPECIAL_FUNCTION_EPSILON) {
+				return ComplementTail(prefix * h, true, upper, out);
+			}
+		}
+		return false;
+	}
+};
+
+// I_x(a, b) and its complement for one pair of shapes.
+struct IncompleteBeta {
+	double a = std::numeric_limits<double>::quiet_NaN();
+	double b = std::numeric_limits<double>::quiet_NaN();
+	bool in_range = false;
+	// The mode of x^a y^b on x + y = 1, the smaller coordinate divided out and the larger one
+	// its complement so that they sum to one exactly.
+	double mode_x = 0;
+	double mode_y = 0;
+	// log(x^a y^b / B(a, b)) + a * LogRatioDeviation(x, mode_x) + b * LogRatioDeviation(y, mode_y)
+	double log_scale = 0;
+
+	IncompleteBeta() = default;
+	IncompleteBeta(double a, double b, double max_shape)
+	    : a(a), b(b), in_range(a <= max_shape && b <= max_shape), mode_x(a <= b ? a / (a + b) : 1 - b / (a + b)),
+	      mode_y(a <= b ? 1 - mode_x : b / (a + b)),
+	      log_scale(0.5 * std::log(a * b / (boost::math::constants::two_pi<double>() * (a + b))) - StirlingError(a) -
+	                StirlingError(b) + StirlingError(a + b)) {
+	}
+
+	// Sets out to 1 - I_x(a, b) if upper, else I_x(a, b). y is 1 - x, passed separately so
+	// callers that know it more accurately than 1 - x (Student's t, Fisher F) keep the digits.
+	bool Evaluate(double x, double y, bool upper, double &out) const {
+		if (!in_range || !(x >= 0) || !(y >= 0)) {
+			return false;
+		}
+		if (x == 0 || y == 0) {
+			out = (x == 0) == upper ? 1 : 0;
+			return true;
+		}
+		// a log(x / mode_x) + b log(y / mode_y), the linear terms of which sum to (a + b)(x + y - 1)
+		const double prefix = std::exp(log_scale - a * LogRatioDeviation(x, mode_x) -
+		                               b * LogRatioDeviation(y, mode_y) + (a + b) * ((x - mode_x) + (y - mode_y)));
+		double fraction;
+		if (x < (a + 1) / (a + b + 2)) {
+			return ContinuedFraction(a, b, x, fraction) && ComplementTail(prefix * fraction / a, false, upper, out);
+		}
+		return ContinuedFraction(b, a, y, fraction) && ComplementTail(prefix * fraction / b, true, upper, out);
+	}
+
+	// The continued fraction of I_x(a, b) / (x^a y^b / (a B(a, b))), by the modified Lentz method.
+	static bool ContinuedFraction(double a, double b, double x, double &result) {
+		double c = 1;
+		double d = 1 - (a + b) * x / (a + 1);
+		d = 1 / (std::fabs(d) < SPECIAL_FUNCTION_TINY ? SPECIAL_FUNCTION_TINY : d);
+		double h = d;
+		for (int m = 1; m < SPECIAL_FUNCTION_MAX_ITERATIONS; m++) {
+			const double even = m * (b - m) * x / ((a - 1 + 2 * m) * (a + 2 * m));
+			d = 1 + even * d;
+			d = 1 / (std::fabs(d) < SPECIAL_FUNCTION_TINY ? SPECIAL_FUNCTION_TINY : d);
+			c = 1 + even / c;
+			c = std::fabs(c) < SPECIAL_FUNCTION_TINY ? SPECIAL_FUNCTION_TINY : c;
+			h *= d * c;
+
+			const double odd = -(a + m) * (a + b + m) * x / ((a + 2 * m) * (a + 1 + 2 * m));
+			d = 1 + odd * d;
+			d = 1 / (std::fabs(d) < SPECIAL_FUNCTION_TINY ? SPECIAL_FUNCTION_TINY : d);
+			c = 1 + odd / c;
+			c = std::fabs(c) < SPECIAL_FUNCTION_TINY ? SPECIAL_FUNCTION_TINY : c;
+			const double delta = d * c;
+			h *= delta;
+			if (std::fabs(delta - 1) < SPECIAL_FUNCTION_EPSILON) {
+				result = h;
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+// The kernels below set out[i] to the lower or upper tail at x[i] and list the rows they leave
+// to boost::math in fallback, returning how many there are; rows with shapes above max_shape
+// are left too. Like the samplers they take the parameters in the order of the boost::math
+// distribution of their file.
+
+// P(shape, x / scale)
+struct gamma_cdf_kernel {
+	static idx_t Evaluate(idx_t count, const double *shape, const double *scale, const double *x, bool upper,
+	                      double max_shape, double *out, sel_t *fallback) {
+		IncompleteGamma gamma;
+		idx_t fallback_count = 0;
+		for (idx_t i = 0; i < count; i++) {
+			if (!(shape[i] == gamma.a)) {
+				gamma = IncompleteGamma(shape[i], max_shape);
+			}
+			fallback[fallback_count] = sel_t(i);
+			fallback_count += !gamma.Evaluate(x[i] / scale[i], upper, out[i]);
+		}
+		return fallback_count;
+	}
+};
+
+// P(df / 2, x / 2)
+struct chi_squared_cdf_kernel {
+	static idx_t Evaluate(idx_t count, const double *degrees_of_freedom, const double *x, bool upper, double max_shape,
+	                      double *out, sel_t *fallback) {
+		IncompleteGamma gamma;
+		idx_t fallback_count = 0;
+		for (idx_t i = 0; i < count; i++) {
+			if (!(degrees_of_freedom[i] / 2 == gamma.a)) {
+				gamma = IncompleteGamma(degrees_of_freedom[i] / 2, max_shape);
+			}
+			fallback[fallback_count] = sel_t(i);
+			fallback_count += !gamma.Evaluate(x[i] / 2, upper, out[i]);
+		}
+		return fallback_count;
+	}
+};
+
+// I_x(alpha, beta)
+struct beta_cdf_kernel {
+	static idx_t Evaluate(idx_t count, const double *alpha, const double *beta, const double *x, bool upper,
+	                      double max_shape, double *out, sel_t *fallback) {
+		IncompleteBeta incomplete_beta;
+		idx_t fallback_count = 0;
+		for (idx_t i = 0; i < count; i++) {
+			if (!(alpha[i] == incomplete_beta.a && beta[i] == incomplete_beta.b)) {
+				incomplete_beta = IncompleteBeta(alpha[i], beta[i], max_shape);
+			}
+			fallback[fallback_count] = sel_t(i);
+			fallback_count += !(x[i] <= 1) || !incomplete_beta.Evaluate(x[i], 1 - x[i], upper, out[i]);
+		}
+		return fallback_count;
+	}
+};
+
+// P(|T| > |t|) = I_z(df / 2, 1 / 2) with z = df / (df + t^2); each tail of t is half of that or
+// one minus half of it.
+struct students_t_cdf_kernel {
+	static idx_t Evaluate(idx_t count, const double *degrees_of_freedom, const double *t, bool upper, double max_shape,
+	                      double *out, sel_t *fallback) {
+		IncompleteBeta incomplete_beta;
+		idx_t fallback_count = 0;
+		for (idx_t i = 0; i < count; i++) {
+			const double df = degrees_of_freedom[i];
+			if (!(df / 2 == incomplete_beta.a)) {
+				incomplete_beta = IncompleteBeta(df / 2, 0.5, max_shape);
+			}
+			const double t2 = t[i] * t[i];
+			// The requested tail lies beyond t rather than containing zero.
+			const bool outer = upper == (t[i] > 0);
+			double value = 0;
+			const bool ok = std::isfinite(t2) &&
+			                incomplete_beta.Evaluate(df / (df + t2), t2 / (df + t2), !outer, value);
+			out[i] = outer ? value / 2 : 0.5 + value / 2;
+			fallback[fallback_count] = sel_t(i);
+			fallback_count += !ok;
+		}
+		return fallback_count;
+	}
+};
+
+// I_z(d1 / 2, d2 / 2) with z = d1 x / (d1 x + d2)
+struct fisher_f_cdf_kernel {
+	static idx_t Evaluate(idx_t count, const double *d1, const double *d2, const double *x, bool upper, double max_shape,
+	                      double *out, sel_t *fallback) {
+		IncompleteBeta incomplete_beta;
+		idx_t fallback_count = 0;
+		for (idx_t i = 0; i < count; i++) {
+			if (!(d1[i] / 2 == incomplete_beta.a && d2[i] / 2 == incomplete_beta.b)) {
+				incomplete_beta = IncompleteBeta(d1[i] / 2, d2[i] / 2, max_shape);
+			}
+			const double scaled = d1[i] * x[i];
+			const double total = scaled + d2[i];
+			fallback[fallback_count] = sel_t(i);
+			fallback_count += !std::isfinite(total) ||
+			                  !incomplete_beta.Evaluate(scaled / total, d2[i] / total, upper, out[i]);
+		}
+		return fallback_count;
+	}
+};
+
+} // namespace duckdb
@@ -0,0 +1,153 @@
+#pragma once
+#include "duckdb.hpp"
+#include "duckdb/common/optional_idx.hpp"
+#include "duckdb/storage/object_cache.hpp"
+#include "function_state.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace duckdb {
+
+// Name of the setting bounding the bytes held by the cross-query table cache; 0 disables it.
+constexpr const char *STOCHASTIC_CACHE_SIZE_SETTING = "stochastic_cache_size";
+constexpr uint64_t STOCHASTIC_CACHE_DEFAULT_SIZE = uint64_t(256) << 20;
+
+// Identifies a cached table: the function that built it (which names the distribution and the
+// kind of table, e.g. dist_gamma_quantiles), the precision it was built with, and the bit
+// patterns of its inputs (the distribution parameters, then any per-table inputs such as the
+// probabilities of a quantile list).
+struct StochasticCacheKey {
+	idx_t function_id;
+	StochasticPrecision precision;
+	vector<uint64_t> words;
+
+	void Add(double value) {
+		uint64_t word;
+		std::memcpy(&word, &value, sizeof(word));
+		words.push_back(word);
+	}
+	void Add(int64_t value) {
+		words.push_back(uint64_t(value));
+	}
+
+	bool operator==(const StochasticCacheKey &other) const {
+		return function_id == other.function_id && precision == other.precision && words == other.words;
+	}
+};
+
+struct StochasticCacheKeyHash {
+	size_t operator()(const StochasticCacheKey &key) const {
+		uint64_t hash = key.function_id * 0x9E3779B97F4A7C15ULL + uint64_t(key.precision);
+		for (auto word : key.words) {
+			hash = (hash ^ word) * 0xBF58476D1CE4E5B9ULL;
+			hash ^= hash >> 31;
+		}
+		return size_t(hash);
+	}
+};
+
+using StochasticTable = shared_ptr<const vector<double>>;
+
+// Merged view of the cache counters, produced on read.
+struct StochasticCacheStats {
+	uint64_t entries = 0;
+	uint64_t bytes = 0;
+	uint64_t hits = 0;
+	uint64_t misses = 0;
+	uint64_t evictions = 0;
+};
+
+// Tables that are expensive to build for a parameter set (pmf tables, quantile lists), kept in
+// the database's ObjectCache so every connection and every later query reuses them. The executors
+// consult it once per distinct parameter set of a chunk. Entries are spread over shards by the
+// hash of their key, each with its own mutex, recency list and an equal share of the byte budget,
+// so threads looking up different tables rarely wait for each other. Lookups and inserts are
+// O(1); inserts evict the least recently used tables of the shard until the new one fits, and a
+// table larger than a shard's budget is not kept.
+class StochasticCache : public ObjectCacheEntry {
+public:
+	static constexpr idx_t SHARD_COUNT = 16;
+
+	static string ObjectType() {
+		return "stochastic_table_cache";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+	// Memory held by the tables, for ObjectCache versions that account for their entries.
+	optional_idx GetEstimatedCacheMemory() const {
+		return optional_idx(bytes.load(std::memory_order_relaxed));
+	}
+
+	// Returns the table stored under key, or nullptr.
+	StochasticTable Get(const StochasticCacheKey &key);
+	// Stores table under key, replacing any previous table, and evicts down to the capacity.
+	void Put(StochasticCacheKey key, StochasticTable table);
+	// Sets the bytes the tables may hold, evicting down to a lowered capacity at once; the value of
+	// stochastic_cache_size of the latest query wins.
+	void SetCapacity(idx_t new_capacity);
+	StochasticCacheStats Stats();
+
+private:
+	// Most recently used first; the keys point into entries, whose nodes do not move.
+	using RecencyList = std::list<const StochasticCacheKey *>;
+	struct Entry {
+		StochasticTable table;
+		RecencyList::iterator recency;
+	};
+	using EntryMap = std::unordered_map<StochasticCacheKey, Entry, StochasticCacheKeyHash>;
+
+	struct Shard {
+		std::mutex lock;
+		EntryMap entries;
+		RecencyList recency;
+		// Guarded by lock.
+		uint64_t bytes = 0;
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+		uint64_t evictions = 0;
+
+		void Erase(EntryMap::iterator entry);
+		// Evicts the least recently used tables until bytes + reserve fits limit.
+		void EvictTo(uint64_t limit, uint64_t reserve);
+	};
+
+	Shard &GetShard(const StochasticCacheKey &key) {
+		return shards[StochasticCacheKeyHash()(key) % SHARD_COUNT];
+	}
+
+	std::array<Shard, SHARD_COUNT> shards;
+	std::atomic<uint64_t> capacity {STOCHASTIC_CACHE_DEFAULT_SIZE};
+	// Sum of the shards' bytes, kept for GetEstimatedCacheMemory.
+	std::atomic<uint64_t> bytes {0};
+};
+
+// The cache of the calling function's database, or nullptr when stochastic_cache_size is 0. It is
+// looked up in the ObjectCache on first use by each thread's function state.
+optional_ptr<StochasticCache> GetStochasticCache(ExpressionState &state);
+
+// A key for the calling function and precision, to which the caller adds the table's inputs.
+StochasticCacheKey MakeStochasticCacheKey(ExpressionState &state);
+
+// Writes length values to out from the table cached under key when there is one at least that
+// long, otherwise runs fill(out) and caches the result. A longer table is used as its prefix, so
+// fill must write the same values whatever the length, as FillPmfRange does.
+template <typename Fill>
+void CachedTable(StochasticCache &cache, StochasticCacheKey key, idx_t length, double *out, Fill fill) {
+	auto table = cache.Get(key);
+	if (table && table->size() >= length) {
+		std::copy(table->begin(), table->begin() + length, out);
+		return;
+	}
+	fill(out);
+	cache.Put(std::move(key), make_shared_ptr<const vector<double>>(out, out + length));
+}
+
+void LoadStochasticCache(ExtensionLoader &loader);
+
+} // namespace duckdb
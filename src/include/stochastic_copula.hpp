@@ -0,0 +1,10 @@
+#pragma once
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+// copula_sample(n, corr, marginals...): n rows of one DOUBLE column per marginal DISTRIBUTION,
+// coupled by a Gaussian copula, or a Student's t copula with the named parameter df.
+void LoadCopula(ExtensionLoader &loader);
+
+} // namespace duckdb
@@ -0,0 +1,10 @@
+#pragma once
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+// dist_dirichlet_sample(alpha) and dist_multinomial_sample(n, p), which return one LIST per row
+// with as many components as the parameter list.
+void LoadDirichletMultinomial(ExtensionLoader &loader);
+
+} // namespace duckdb
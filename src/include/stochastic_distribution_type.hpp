@@ -0,0 +1,39 @@
+#pragma once
+#include "duckdb.hpp"
+#include "duckdb/function/scalar_function.hpp"
+
+namespace duckdb {
+
+// Name of the logical type holding a distribution as a value.
+constexpr const char *DISTRIBUTION_TYPE_NAME = "DISTRIBUTION";
+
+// Families a DISTRIBUTION can hold, by tag. New families are appended so stored tags keep their meaning.
+static constexpr const char *DISTRIBUTION_FAMILIES[] = {
+    "bernoulli", "beta",      "binomial",  "cauchy",    "chi_squared", "exponential",       "extreme_value",
+    "fisher_f",  "gamma",     "geometric", "laplace",   "logistic",    "lognormal",         "negative_binomial",
+    "normal",    "pareto",    "poisson",   "rayleigh",  "students_t",  "uniform_int",       "uniform_real",
+    "weibull",   "zipf"};
+static constexpr idx_t DISTRIBUTION_FAMILY_COUNT = sizeof(DISTRIBUTION_FAMILIES) / sizeof(DISTRIBUTION_FAMILIES[0]);
+
+// Functions of the families that the generic dist_<kernel>(DISTRIBUTION, ...) functions dispatch to.
+static constexpr const char *DISTRIBUTION_KERNELS[] = {"pdf", "log_pdf", "cdf", "cdf_complement", "quantile", "sample"};
+
+// DISTRIBUTION: STRUCT(family ENUM, param1 DOUBLE, param2 DOUBLE). The parameters are stored as
+// DOUBLE whatever their type in the family's functions; param2 is NULL for one parameter families.
+LogicalType DistributionValueType();
+
+// The tag of a family, or DConstants::INVALID_INDEX when it is not in DISTRIBUTION_FAMILIES.
+idx_t DistributionFamilyTag(const string &family);
+
+bool IsDistributionKernel(const string &kernel);
+
+// Records the scalar function behind dist_<family>_<kernel> for the generic functions, with the
+// names of the family's parameters (the leading arg_types). A family registers a name once per
+// overload; the first one, its DOUBLE overload, is kept.
+void RegisterDistributionKernel(const string &family, const string &kernel, const vector<LogicalType> &arg_types,
+                                const vector<string> &param_names, const LogicalType &return_type,
+                                scalar_function_t function);
+
+void LoadDistributionType(ExtensionLoader &loader);
+
+} // namespace duckdb
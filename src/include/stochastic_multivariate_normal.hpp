@@ -0,0 +1,141 @@
+#pragma once
+#include "duckdb.hpp"
+#include "rng_utils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace duckdb {
+
+// Lower triangular Cholesky factor L of a covariance matrix C = L L^T, kept row-major as a full
+// d x d matrix with zeros above the diagonal. A multivariate normal sample is mean + L z for a
+// vector z of independent standard normals.
+struct CholeskyFactor {
+	idx_t dimension = 0;
+	vector<double> lower;
+
+	// Factors the row-major d x d matrix. Returns false when it has non-finite entries or is not
+	// symmetric positive semidefinite. Semidefinite matrices (perfectly correlated or constant
+	// components) are accepted: a pivot that vanishes to rounding leaves a zero column.
+	bool Factor(const double *matrix, idx_t d) {
+		dimension = d;
+		lower.assign(d * d, 0);
+		for (idx_t i = 0; i < d; i++) {
+			for (idx_t j = 0; j <= i; j++) {
+				const double a = matrix[i * d + j];
+				const double b = matrix[j * d + i];
+				if (!std::isfinite(a) || !std::isfinite(b) || std::abs(a - b) > 1e-12 * Scale(matrix, d, i, j)) {
+					return false;
+				}
+			}
+		}
+		// The rounding of the sums below is bounded by about d ulps of sqrt(C_ii C_jj).
+		const double tolerance = 16 * double(d) * std::numeric_limits<double>::epsilon();
+
+		for (idx_t i = 0; i < d; i++) {
+			double *row = lower.data() + i * d;
+			for (idx_t j = 0; j <= i; j++) {
+				const double *pivot_row = lower.data() + j * d;
+				double sum = matrix[i * d + j];
+				for (idx_t k = 0; k < j; k++) {
+					sum -= row[k] * pivot_row[k];
+				}
+				const double bound = tolerance * Scale(matrix, d, i, j);
+				if (j == i) {
+					if (sum < -bound) {
+						return false;
+					}
+					row[i] = sum > bound ? std::sqrt(sum) : 0;
+				} else if (pivot_row[j] > 0) {
+					row[j] = sum / pivot_row[j];
+				} else if (std::abs(sum) > bound) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+private:
+	static double Scale(const double *matrix, idx_t d, idx_t i, idx_t j) {
+		return std::sqrt(std::abs(matrix[i * d + i] * matrix[j * d + j]));
+	}
+};
+
+// Rows drawn together by SampleMultivariateNormal. The normals of a block, d * 32 values, stay in
+// the L2 cache for d in the hundreds while each row of the factor streams over them once.
+static constexpr idx_t MULTIVARIATE_NORMAL_BLOCK = 32;
+
+// Writes count samples of N(mean_r, L L^T) to out, row r at out[r * d]; means[r] is the mean of
+// row r. The standard normals of a block of rows are laid out component-major so the triangular
+// product L z runs as one axpy per factor entry across the whole block, which the compiler
+// vectorizes, instead of a dot product per sample.
+static inline void SampleMultivariateNormal(const CholeskyFactor &factor, const double *const *means, idx_t count,
+                                            double *out) {
+	constexpr idx_t BLOCK = MULTIVARIATE_NORMAL_BLOCK;
+	const idx_t d = factor.dimension;
+	vector<double> normals(d * BLOCK);
+	for (idx_t start = 0; start < count; start += BLOCK) {
+		const idx_t block_count = std::min(BLOCK, count - start);
+		// normals[j * BLOCK + s] is component j of row start + s.
+		for (idx_t offset = 0; offset < d * BLOCK; offset += STANDARD_VECTOR_SIZE) {
+			FillStandardNormal(normals.data() + offset, std::min<idx_t>(STANDARD_VECTOR_SIZE, d * BLOCK - offset));
+		}
+		for (idx_t i = 0; i < d; i++) {
+			const double *row = factor.lower.data() + i * d;
+			double sums[BLOCK];
+			for (idx_t s = 0; s < BLOCK; s++) {
+				sums[s] = 0;
+			}
+			for (idx_t j = 0; j <= i; j++) {
+				const double l = row[j];
+				const double *z = normals.data() + j * BLOCK;
+				for (idx_t s = 0; s < BLOCK; s++) {
+					sums[s] += l * z[s];
+				}
+			}
+			for (idx_t s = 0; s < block_count; s++) {
+				out[(start + s) * d + i] = means[start + s][i] + sums[s];
+			}
+		}
+	}
+}
+
+// Appends the elements of a list or array value to out; false when it is NULL or holds a NULL.
+static inline bool AppendValues(const Value &value, vector<double> &out) {
+	Value list;
+	string error;
+	if (value.IsNull() || !value.DefaultTryCastAs(LogicalType::LIST(LogicalType::DOUBLE), list, &error)) {
+		return false;
+	}
+	for (auto &element : ListValue::GetChildren(list)) {
+		if (element.IsNull()) {
+			return false;
+		}
+		out.push_back(element.GetValue<double>());
+	}
+	return true;
+}
+
+// The d x d matrix of a value holding d lists or arrays of d numbers, row-major; false when the
+// value has another shape or holds a NULL.
+static inline bool MatrixValues(const Value &value, idx_t dimension, vector<double> &out) {
+	Value rows;
+	string error;
+	const auto rows_type = LogicalType::LIST(LogicalType::LIST(LogicalType::DOUBLE));
+	if (value.IsNull() || !value.DefaultTryCastAs(rows_type, rows, &error) ||
+	    ListValue::GetChildren(rows).size() != dimension) {
+		return false;
+	}
+	out.clear();
+	for (auto &row : ListValue::GetChildren(rows)) {
+		if (!AppendValues(row, out)) {
+			return false;
+		}
+	}
+	return out.size() == dimension * dimension;
+}
+
+void LoadMultivariateNormal(ExtensionLoader &loader);
+
+} // namespace duckdb
@@ -0,0 +1,145 @@
+#pragma once
+#include "duckdb.hpp"
+#include "duckdb/storage/object_cache.hpp"
+#include "function_state.hpp"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+
+namespace duckdb {
+
+// A counter that is only ever written by the thread that owns it, so an increment is a plain
+// relaxed load and store rather than a locked read-modify-write. Readers on other threads
+// may observe a slightly stale value, which is fine for statistics.
+struct RelaxedCounter {
+	std::atomic<uint64_t> value {0};
+
+	inline void Add(uint64_t amount) {
+		value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+	}
+	inline uint64_t Load() const {
+		return value.load(std::memory_order_relaxed);
+	}
+};
+
+// Execution counters of one function state, that is of one function in one thread of a query.
+struct StochasticFunctionCounters {
+	explicit StochasticFunctionCounters(idx_t function_id) : function_id(function_id) {
+	}
+
+	idx_t function_id;
+	RelaxedCounter chunks;
+	RelaxedCounter rows;
+	// All arguments were constant vectors, the distribution was built once.
+	RelaxedCounter constant_path;
+	// The distribution parameters were constant but the call parameter varied.
+	RelaxedCounter constant_params_path;
+	// The distribution was constructed for every row.
+	RelaxedCounter per_row_path;
+	RelaxedCounter validation_failures;
+	RelaxedCounter nanoseconds;
+};
+
+// Merged view of the counters of one function, produced on read.
+struct StochasticFunctionStats {
+	string function_name;
+	uint64_t chunks = 0;
+	uint64_t rows = 0;
+	uint64_t constant_path = 0;
+	uint64_t constant_params_path = 0;
+	uint64_t per_row_path = 0;
+	uint64_t validation_failures = 0;
+	uint64_t nanoseconds = 0;
+};
+
+// The statistics of one database, kept in its ObjectCache so that databases in the same process
+// count separately. Function states attach their counters on first use and fold them into the
+// totals when the query releases them; stochastic_stats() merges the totals with the live ones.
+class StochasticStats : public ObjectCacheEntry {
+public:
+	static string ObjectType() {
+		return "stochastic_stats";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	// Assigns a stable id to a function name, called when the function is registered. The ids are
+	// shared by every database of the process, as the extension registers the same functions in each.
+	static idx_t RegisterFunctionName(const string &name);
+	// Returns the id of a registered function, or DConstants::INVALID_INDEX.
+	static idx_t GetFunctionId(const string &name);
+	// Returns the counters of the calling function state, attaching them on first use, or nullptr
+	// for functions without statistics.
+	static optional_ptr<StochasticFunctionCounters> LocalCounters(ExpressionState &state);
+
+	// Creates counters for a function state; they are read by Collect until Retire.
+	StochasticFunctionCounters &Attach(idx_t function_id);
+	// Folds the counters into the totals and releases them.
+	void Retire(StochasticFunctionCounters &counters);
+	// Merges the totals and the counters of the live function states.
+	vector<StochasticFunctionStats> Collect();
+
+private:
+	std::mutex lock;
+	std::unordered_map<StochasticFunctionCounters *, unique_ptr<StochasticFunctionCounters>> live;
+	// Totals folded in from retired function states, by function id.
+	vector<StochasticFunctionStats> retired;
+};
+
+// Counts a vector aborted by invalid parameters, just before the error is raised.
+inline void CountValidationFailure(ExpressionState &state) {
+	auto counters = StochasticStats::LocalCounters(state);
+	if (counters) {
+		counters->validation_failures.Add(1);
+	}
+}
+
+// Records one chunk worth of work for the function being executed. The elapsed time and row
+// count are added when the scope ends.
+class StochasticStatsScope {
+public:
+	StochasticStatsScope(ExpressionState &state, idx_t row_count) : counters(StochasticStats::LocalCounters(state)) {
+		if (!counters) {
+			return;
+		}
+		rows = row_count;
+		start = std::chrono::steady_clock::now();
+	}
+
+	~StochasticStatsScope() {
+		if (!counters) {
+			return;
+		}
+		auto elapsed = std::chrono::steady_clock::now() - start;
+		counters->chunks.Add(1);
+		counters->rows.Add(rows);
+		counters->nanoseconds.Add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+	}
+
+	inline void ConstantPath() {
+		if (counters) {
+			counters->constant_path.Add(1);
+		}
+	}
+	inline void ConstantParamsPath() {
+		if (counters) {
+			counters->constant_params_path.Add(1);
+		}
+	}
+	inline void PerRowPath() {
+		if (counters) {
+			counters->per_row_path.Add(1);
+		}
+	}
+
+private:
+	optional_ptr<StochasticFunctionCounters> counters;
+	idx_t rows = 0;
+	std::chrono::steady_clock::time_point start;
+};
+
+void LoadStochasticStats(ExtensionLoader &loader);
+
+} // namespace duckdb
@@ -9,6 +9,17 @@
 #include <boost/random.hpp>
 #include "rng_utils.hpp"
 #include "distribution_traits.hpp"
+#include "inverse_transform.hpp"
+#include "batch_samplers.hpp"
+#include "special_functions.hpp"
+#include "stochastic_stats.hpp"
+#include "stochastic_cache.hpp"
+#include "stochastic_distribution_type.hpp"
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
 #include <type_traits>
 #include <utility> // std::declval
 namespace duckdb {
@@ -30,11 +41,21 @@ void RegisterFunction(ExtensionLoader &loader, const std::string &name, const Fu
 	const auto final_name = string(prefix + string(distribution_traits<DistributionType>::prefix) + "_" + name);
 	const auto final_example = string(prefix + string(distribution_traits<DistributionType>::prefix) + "_" + example);
 
-	auto function =
-	    ScalarFunction(final_name, final_types, result_type, func, nullptr, nullptr, nullptr, nullptr,
-	                   LogicalTypeId::INVALID, stability, FunctionNullHandling::DEFAULT_NULL_HANDLING, nullptr);
+	StochasticStats::RegisterFunctionName(final_name);
+	if (IsDistributionKernel(name)) {
+		RegisterDistributionKernel(distribution_traits<DistributionType>::prefix, name, final_types,
+		                           vector<string>(begin(distribution_traits<DistributionType>::param_names),
+		                                          end(distribution_traits<DistributionType>::param_names)),
+		                           result_type, func);
+	}
+
+	auto function = ScalarFunction(final_name, final_types, result_type, func, nullptr, nullptr, nullptr,
+	                               StochasticFunctionLocalState::Init, LogicalTypeId::INVALID, stability,
+	                               FunctionNullHandling::DEFAULT_NULL_HANDLING, nullptr);
 
 	CreateScalarFunctionInfo info(function);
+	// Merge with an existing function of the same name so overloads (e.g. FLOAT) can be added.
+	info.on_conflict = OnCreateConflict::ALTER_ON_CONFLICT;
 	FunctionDescription desc;
 	desc.description = description;
 	desc.examples.push_back(final_example);
@@ -52,502 +73,1052 @@ void RegisterFunction(ExtensionLoader &loader, const std::string &name, const Fu
 	loader.RegisterFunction(info);
 }
 
-template <typename DistributionType, typename ReturnType>
-inline void DistributionSampleUnary(DataChunk &args, ExpressionState &state, Vector &result) {
-	using traits = distribution_traits<DistributionType>;
-	using DistParam1 = typename traits::param1_t;
+// Raises the error for parameters that failed ParametersValid, counting a validation failure.
+// ValidateParameters produces the message; the only parameters it accepts that ParametersValid
+// rejects are NaNs.
+template <typename DistributionType, typename... ParamTypes>
+[[noreturn]] inline void RaiseInvalidParameters(ExpressionState &state, ParamTypes... params) {
+	CountValidationFailure(state);
+	distribution_traits<DistributionType>::ValidateParameters(params...);
+	throw InvalidInputException(string(distribution_traits<DistributionType>::prefix) +
+	                            ": Parameters must not be NaN");
+}
 
-	auto &param1_vector = args.data[0];
+// Validates constant parameters once for the whole chunk. Invalid parameters raise, or when
+// stochastic_error_mode is 'null' set the result to a constant NULL and return true.
+template <typename DistributionType, typename... ParamTypes>
+inline bool CheckConstantParameters(ExpressionState &state, Vector &result, ParamTypes... params) {
+	if (distribution_traits<DistributionType>::ParametersValid(params...)) {
+		return false;
+	}
+	if (!StochasticFunctionLocalState::NullOnInvalid(state)) {
+		RaiseInvalidParameters<DistributionType>(state, params...);
+	}
+	result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	ConstantVector::SetNull(result, true);
+	return true;
+}
 
-	if (param1_vector.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-		if (ConstantVector::IsNull(param1_vector)) {
-			result.SetVectorType(VectorType::CONSTANT_VECTOR);
-			ConstantVector::SetNull(result, true);
-			return;
-		}
+// The columns of a chunk holding distribution (and call) parameters, read in unified format.
+// When every column is constant or flat and none holds a NULL, rows are read through a data
+// pointer and a stride, 0 for a constant column and 1 for a flat one, so the loops need no
+// selection vector and no validity checks whichever subset of the columns is constant.
+template <typename... ColumnTypes>
+class ParameterColumns {
+public:
+	static constexpr idx_t COUNT = sizeof...(ColumnTypes);
+
+	// Reads args.data[first_column], ..., args.data[first_column + COUNT - 1].
+	ParameterColumns(DataChunk &args, idx_t first_column) {
+		Init(args, first_column, std::index_sequence_for<ColumnTypes...>());
+	}
 
-		const auto param1 = ConstantVector::GetData<DistParam1>(param1_vector)[0];
+	// Calls fun(i, values...) for every row without a NULL column, and null_row(i) for the others.
+	template <typename Fun, typename NullFun>
+	void ForEachRow(idx_t count, Fun &&fun, NullFun &&null_row) const {
+		ForEachRow(count, fun, null_row, std::index_sequence_for<ColumnTypes...>());
+	}
 
-		distribution_traits<DistributionType>::ValidateParameters(param1);
-		// Create distribution once and reuse for constant vectors
-		DistributionType dist(param1);
-		const auto results = FlatVector::GetData<ReturnType>(result);
+	// Branch-free reduction of pred(values...) over the rows; rows with a NULL column pass.
+	template <typename Pred>
+	bool AllRows(idx_t count, Pred &&pred) const {
+		return AllRows(count, pred, std::index_sequence_for<ColumnTypes...>());
+	}
 
-		for (size_t i = 0; i < args.size(); i++) {
-			results[i] = dist(rng);
+private:
+	template <size_t... I>
+	void Init(DataChunk &args, idx_t first_column, std::index_sequence<I...>) {
+		for (idx_t c = 0; c < COUNT; c++) {
+			auto &vector = args.data[first_column + c];
+			vector.ToUnifiedFormat(args.size(), formats[c]);
+			const bool constant = vector.GetVectorType() == VectorType::CONSTANT_VECTOR;
+			strides[c] = constant ? 0 : 1;
+			strided &= (constant || !formats[c].sel->IsSet()) && formats[c].validity.AllValid();
 		}
+		entries = std::make_tuple(UnifiedVectorFormat::GetData<ColumnTypes>(formats[I])...);
+	}
 
-		// Set vector type appropriately
-		if (args.size() == 1) {
-			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	template <typename Fun, typename NullFun, size_t... I>
+	void ForEachRow(idx_t count, Fun &fun, NullFun &null_row, std::index_sequence<I...>) const {
+		if (strided) {
+			for (idx_t i = 0; i < count; i++) {
+				fun(i, std::get<I>(entries)[i * strides[I]]...);
+			}
+			return;
+		}
+		for (idx_t i = 0; i < count; i++) {
+			const std::array<idx_t, COUNT> indexes {formats[I].sel->get_index(i)...};
+			if ((formats[I].validity.RowIsValid(indexes[I]) && ...)) {
+				fun(i, std::get<I>(entries)[indexes[I]]...);
+			} else {
+				null_row(i);
+			}
 		}
-		return;
 	}
 
-	// Handle non-constant vectors
-	UnaryExecutor::Execute<DistParam1, ReturnType>(param1_vector, result, args.size(), [](DistParam1 param1) {
-		distribution_traits<DistributionType>::ValidateParameters(param1);
-		DistributionType dist(param1);
-		return dist(rng);
-	});
-}
-
-template <typename DistributionType, typename ReturnType>
-inline void DistributionSampleBinary(DataChunk &args, ExpressionState &state, Vector &result) {
-	using traits = distribution_traits<DistributionType>;
-	using DistParam1 = typename traits::param1_t;
-	using DistParam2 = typename traits::param2_t;
-
-	auto &param1_vector = args.data[0];
-	auto &param2_vector = args.data[1];
-
-	if (param1_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
-	    param2_vector.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-		if (ConstantVector::IsNull(param1_vector) || ConstantVector::IsNull(param2_vector)) {
-			result.SetVectorType(VectorType::CONSTANT_VECTOR);
-			ConstantVector::SetNull(result, true);
-			return;
+	template <typename Pred, size_t... I>
+	bool AllRows(idx_t count, Pred &pred, std::index_sequence<I...>) const {
+		bool all_valid = true;
+		if (strided) {
+			for (idx_t i = 0; i < count; i++) {
+				all_valid &= pred(std::get<I>(entries)[i * strides[I]]...);
+			}
+			return all_valid;
+		}
+		for (idx_t i = 0; i < count; i++) {
+			const std::array<idx_t, COUNT> indexes {formats[I].sel->get_index(i)...};
+			all_valid &=
+			    pred(std::get<I>(entries)[indexes[I]]...) | (!formats[I].validity.RowIsValid(indexes[I]) | ...);
 		}
+		return all_valid;
+	}
 
-		const auto param1 = ConstantVector::GetData<DistParam1>(param1_vector)[0];
-		const auto param2 = ConstantVector::GetData<DistParam2>(param2_vector)[0];
+	std::array<UnifiedVectorFormat, COUNT> formats;
+	std::array<idx_t, COUNT> strides;
+	std::tuple<const ColumnTypes *...> entries;
+	bool strided = true;
+};
+
+template <typename Tuple>
+struct parameter_columns;
+
+template <typename... ColumnTypes>
+struct parameter_columns<std::tuple<ColumnTypes...>> {
+	using type = ParameterColumns<ColumnTypes...>;
+};
+
+// The columns of the parameters of DistributionType, which lead the arguments of its functions.
+template <typename DistributionType>
+using DistributionColumns = typename parameter_columns<distribution_param_types_t<DistributionType>>::type;
+
+// Validates the parameter vectors of a chunk before any distribution is built, so the math
+// loops that follow contain no checks. The pass is a branch-free reduction of ParametersValid,
+// over contiguous memory when the vectors are flat or constant and have no NULLs. Returns false
+// when every row is valid. Otherwise raises for the first invalid row, or when
+// stochastic_error_mode is 'null' returns true and the caller marks the invalid rows NULL.
+template <typename DistributionType>
+inline bool CheckParameterVectors(ExpressionState &state, DataChunk &args) {
+	using traits = distribution_traits<DistributionType>;
+	const idx_t count = args.size();
+	DistributionColumns<DistributionType> columns(args, 0);
 
-		distribution_traits<DistributionType>::ValidateParameters(param1, param2);
-		DistributionType dist(param1, param2);
-		const auto results = FlatVector::GetData<ReturnType>(result);
+	const bool all_valid =
+	    columns.AllRows(count, [](auto... params) { return traits::ParametersValid(params...); });
+	if (all_valid || StochasticFunctionLocalState::NullOnInvalid(state)) {
+		return !all_valid;
+	}
 
-		for (size_t i = 0; i < args.size(); i++) {
-			results[i] = dist(rng);
-		}
+	columns.ForEachRow(
+	    count,
+	    [&](idx_t, auto... params) {
+		    if (!traits::ParametersValid(params...)) {
+			    RaiseInvalidParameters<DistributionType>(state, params...);
+		    }
+	    },
+	    [](idx_t) {});
+	throw InternalException("stochastic: invalid parameter row not found");
+}
 
-		// Set vector type appropriately
-		if (args.size() == 1) {
-			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+// True when the parameter vectors of DistributionType, which lead the arguments, are all constant.
+template <typename DistributionType>
+inline bool ConstantParameterVectors(DataChunk &args) {
+	for (idx_t c = 0; c < distribution_traits<DistributionType>::param_names.size(); c++) {
+		if (args.data[c].GetVectorType() != VectorType::CONSTANT_VECTOR) {
+			return false;
 		}
-		return;
 	}
+	return true;
+}
 
-	// Handle non-constant vectors
-	BinaryExecutor::Execute<DistParam1, DistParam2, ReturnType>(
-	    param1_vector, param2_vector, result, args.size(), [](DistParam1 param1, DistParam2 param2) {
-		    distribution_traits<DistributionType>::ValidateParameters(param1, param2);
-		    DistributionType dist(param1, param2);
-		    return dist(rng);
+// Reads and validates the parameters of a chunk whose parameter vectors are all constant and calls
+// fun(params...) with them. When one is NULL, or they are invalid and stochastic_error_mode is
+// 'null', the result becomes a constant NULL and false is returned; invalid parameters raise otherwise.
+template <typename DistributionType, typename Fun>
+inline bool WithConstantParameters(ExpressionState &state, DataChunk &args, Vector &result, Fun &&fun) {
+	bool valid = false;
+	DistributionColumns<DistributionType>(args, 0).ForEachRow(
+	    1,
+	    [&](idx_t, auto... params) {
+		    valid = !CheckConstantParameters<DistributionType>(state, result, params...);
+		    if (valid) {
+			    fun(params...);
+		    }
+	    },
+	    [&](idx_t) {
+		    result.SetVectorType(VectorType::CONSTANT_VECTOR);
+		    ConstantVector::SetNull(result, true);
 	    });
+	return valid;
 }
 
-template <typename DistributionType, typename CallParam, typename Func>
-inline void DistributionCallBinaryUnary(DataChunk &args, ExpressionState &state, Vector &result, Func op) {
+// Writes the value of a row of the result: scalars as they are, pairs (range, support) as the
+// two elements of the row's array.
+template <typename ReturnType>
+struct DistributionResultWriter {
+	static_assert(std::is_scalar_v<ReturnType>, "Unsupported return type for distribution operation");
 
-	using DistParam1 = typename distribution_traits<DistributionType>::param1_t;
-	using DistParam2 = typename distribution_traits<DistributionType>::param2_t;
-	using ReturnType = decltype(op(std::declval<Vector &>(), std::declval<DistributionType &>()));
+	explicit DistributionResultWriter(Vector &result) : data(FlatVector::GetData<ReturnType>(result)) {
+	}
+	void Set(idx_t i, ReturnType value) {
+		data[i] = value;
+	}
 
-	auto &dist_param1_vector = args.data[0];
-	auto &dist_param2_vector = args.data[1];
-	auto &call_param_vector = args.data[2];
+	ReturnType *data;
+};
 
-	// Handle constant vectors optimization
-	if (dist_param1_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
-	    dist_param2_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
-	    call_param_vector.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+template <typename T>
+struct DistributionResultWriter<std::pair<T, T>> {
+	explicit DistributionResultWriter(Vector &result) : data(FlatVector::GetData<T>(ArrayVector::GetEntry(result))) {
+	}
+	void Set(idx_t i, const std::pair<T, T> &value) {
+		data[i * 2] = value.first;
+		data[i * 2 + 1] = value.second;
+	}
 
-		if (ConstantVector::IsNull(dist_param1_vector) || ConstantVector::IsNull(dist_param2_vector) ||
-		    ConstantVector::IsNull(call_param_vector)) {
-			result.SetVectorType(VectorType::CONSTANT_VECTOR);
-			ConstantVector::SetNull(result, true);
-			return;
-		}
+	T *data;
+};
+
+// The executor behind the sampling and evaluation functions, for any number of distribution
+// parameters. args holds the parameters (of the types of distribution_param_types_t), followed
+// by the call parameters CallParams (e.g. x of the pdf), and every row computes
+// op(dist, call_params...). When all parameters are constant, the distribution is built and
+// validated once: the result is a constant, or with VOLATILE (sampling) op runs once per row,
+// and varying call parameters are looped over with that one distribution. Otherwise the rows
+// are validated in one pass and a distribution is built per row.
+template <typename DistributionType, typename ParamTuple = distribution_param_types_t<DistributionType>>
+struct DistributionExecutor;
+
+template <typename DistributionType, typename... ParamTypes>
+struct DistributionExecutor<DistributionType, std::tuple<ParamTypes...>> {
+	static constexpr idx_t PARAM_COUNT = sizeof...(ParamTypes);
+	using traits = distribution_traits<DistributionType>;
 
-		const auto dist_param1 = ConstantVector::GetData<DistParam1>(dist_param1_vector)[0];
-		const auto dist_param2 = ConstantVector::GetData<DistParam2>(dist_param2_vector)[0];
-		const auto call_param = ConstantVector::GetData<CallParam>(call_param_vector)[0];
+	template <bool VOLATILE, typename... CallParams, typename Func>
+	static void Execute(DataChunk &args, ExpressionState &state, Vector &result, Func op) {
+		using ReturnType = decltype(op(std::declval<DistributionType &>(), std::declval<CallParams>()...));
+		const idx_t count = args.size();
+		StochasticStatsScope stats(state, count);
+
+		bool constant_params = true;
+		bool constant_calls = true;
+		for (idx_t c = 0; c < args.ColumnCount(); c++) {
+			const bool constant = args.data[c].GetVectorType() == VectorType::CONSTANT_VECTOR;
+			(c < PARAM_COUNT ? constant_params : constant_calls) &= constant;
+		}
 
-		// Create distribution once for constant case
-		distribution_traits<DistributionType>::ValidateParameters(dist_param1, dist_param2);
-		DistributionType dist(dist_param1, dist_param2);
+		if (constant_params) {
+			if (constant_calls) {
+				stats.ConstantPath();
+			} else {
+				stats.ConstantParamsPath();
+			}
+			ExecuteConstantParams<VOLATILE, ReturnType, CallParams...>(
+			    args, state, result, constant_calls, op, std::index_sequence_for<ParamTypes...>(),
+			    std::index_sequence_for<CallParams...>());
+			return;
+		}
 
-		result.SetVectorType(VectorType::CONSTANT_VECTOR);
-		auto result_data = ConstantVector::GetData<ReturnType>(result);
-		result_data[0] = op(dist, call_param);
-		return;
+		stats.PerRowPath();
+		const bool has_invalid_rows = CheckParameterVectors<DistributionType>(state, args);
+		ParameterColumns<ParamTypes..., CallParams...> columns(args, 0);
+		result.SetVectorType(VectorType::FLAT_VECTOR);
+		DistributionResultWriter<ReturnType> writer(result);
+		columns.ForEachRow(
+		    count,
+		    [&](idx_t i, ParamTypes... params, CallParams... call_params) {
+			    if (has_invalid_rows && !traits::ParametersValid(params...)) {
+				    FlatVector::SetNull(result, i, true);
+				    return;
+			    }
+			    DistributionType dist(params...);
+			    writer.Set(i, op(dist, call_params...));
+		    },
+		    [&](idx_t i) { FlatVector::SetNull(result, i, true); });
 	}
 
-	// Handle distribution parameter constant, call parameter varying
-	if (dist_param1_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
-	    dist_param2_vector.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-		if (ConstantVector::IsNull(dist_param1_vector) || ConstantVector::IsNull(dist_param2_vector)) {
+private:
+	template <bool VOLATILE, typename ReturnType, typename... CallParams, typename Func, size_t... P, size_t... C>
+	static void ExecuteConstantParams(DataChunk &args, ExpressionState &state, Vector &result, bool constant_calls,
+	                                  Func &op, std::index_sequence<P...>, std::index_sequence<C...>) {
+		if ((ConstantVector::IsNull(args.data[P]) || ...) ||
+		    (constant_calls && (ConstantVector::IsNull(args.data[PARAM_COUNT + C]) || ...))) {
 			result.SetVectorType(VectorType::CONSTANT_VECTOR);
 			ConstantVector::SetNull(result, true);
 			return;
 		}
-
-		const auto dist_param1 = ConstantVector::GetData<DistParam1>(dist_param1_vector)[0];
-		const auto dist_param2 = ConstantVector::GetData<DistParam2>(dist_param2_vector)[0];
-		distribution_traits<DistributionType>::ValidateParameters(dist_param1, dist_param2);
-		DistributionType dist(dist_param1, dist_param2);
-
-		UnaryExecutor::Execute<CallParam, ReturnType>(call_param_vector, result, args.size(),
-		                                              [&](CallParam call_param) { return op(dist, call_param); });
-		return;
+		const std::tuple<ParamTypes...> params {ConstantVector::GetData<ParamTypes>(args.data[P])[0]...};
+		if (CheckConstantParameters<DistributionType>(state, result, std::get<P>(params)...)) {
+			return;
+		}
+		// Create distribution once and reuse it for every row
+		DistributionType dist(std::get<P>(params)...);
+
+		const idx_t count = args.size();
+		if constexpr (VOLATILE) {
+			static_assert(sizeof...(CallParams) == 0, "sampling takes no call parameters");
+			DistributionResultWriter<ReturnType> writer(result);
+			for (idx_t i = 0; i < count; i++) {
+				writer.Set(i, op(dist));
+			}
+			if (count == 1) {
+				result.SetVectorType(VectorType::CONSTANT_VECTOR);
+			}
+		} else if (constant_calls) {
+			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+			DistributionResultWriter<ReturnType>(result).Set(
+			    0, op(dist, ConstantVector::GetData<CallParams>(args.data[PARAM_COUNT + C])[0]...));
+		} else {
+			ParameterColumns<CallParams...> columns(args, PARAM_COUNT);
+			result.SetVectorType(VectorType::FLAT_VECTOR);
+			DistributionResultWriter<ReturnType> writer(result);
+			columns.ForEachRow(
+			    count, [&](idx_t i, CallParams... call_params) { writer.Set(i, op(dist, call_params...)); },
+			    [&](idx_t i) { FlatVector::SetNull(result, i, true); });
+		}
 	}
+};
 
-	// Handle general case where both parameters vary
-	TernaryExecutor::Execute<DistParam1, DistParam2, CallParam, ReturnType>(
-	    dist_param1_vector, dist_param2_vector, call_param_vector, result, args.size(),
-	    [&](DistParam1 dist_param1, DistParam2 dist_param2, CallParam call_param) {
-		    distribution_traits<DistributionType>::ValidateParameters(dist_param1, dist_param2);
-		    DistributionType dist(dist_param1, dist_param2);
-		    return op(dist, call_param);
-	    });
+// dist_<name>_sample(params...): one sample per row, from a distribution built once when the
+// parameters are constant.
+template <typename DistributionType, typename ReturnType>
+inline void DistributionSample(DataChunk &args, ExpressionState &state, Vector &result) {
+	DistributionExecutor<DistributionType>::template Execute<true>(
+	    args, state, result, [](DistributionType &dist) { return ReturnType(dist(rng)); });
 }
 
+// Functions of the distribution at one call parameter, e.g. dist_<name>_pdf(params..., x):
+// op(dist, x) for every row.
 template <typename DistributionType, typename CallParam, typename Func>
-inline void DistributionCallUnaryUnary(DataChunk &args, ExpressionState &state, Vector &result, Func op) {
+inline void DistributionCallUnary(DataChunk &args, ExpressionState &state, Vector &result, Func op) {
+	DistributionExecutor<DistributionType>::template Execute<false, CallParam>(args, state, result, op);
+}
 
-	using DistParam1 = typename distribution_traits<DistributionType>::param1_t;
-	using ReturnType = decltype(op(std::declval<Vector &>(), std::declval<DistributionType &>()));
+// Properties of the distribution, e.g. dist_<name>_mean(params...): op(result, dist) for every
+// row, either a scalar or a pair written as a two element array.
+template <typename DistributionType, typename Func>
+inline void DistributionCallNone(DataChunk &args, ExpressionState &state, Vector &result, Func op) {
+	DistributionExecutor<DistributionType>::template Execute<false>(
+	    args, state, result, [&](const DistributionType &dist) { return op(result, dist); });
+}
+
+// Sampling for the distributions with a closed form inverse CDF (see inverse_transform.hpp).
+// A chunk of uniforms is drawn first and the transform then runs over the whole chunk, for
+// constant and per-row parameters alike, with the math functions of Math.
+template <typename SamplerType, typename ReturnType, typename Math>
+inline void SampleInverseTransform(DataChunk &args, ExpressionState &state, Vector &result) {
+	using traits = distribution_traits<SamplerType>;
 
-	auto &dist_param1_vector = args.data[0];
-	auto &call_param_vector = args.data[2];
+	const idx_t count = args.size();
+	StochasticStatsScope stats(state, count);
 
-	// Handle constant vectors optimization
-	if (dist_param1_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
-	    call_param_vector.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+	double uniforms[STANDARD_VECTOR_SIZE];
 
-		if (ConstantVector::IsNull(dist_param1_vector) || ConstantVector::IsNull(call_param_vector)) {
+	if (ConstantParameterVectors<SamplerType>(args)) {
+		stats.ConstantPath();
+		const auto results = FlatVector::GetData<ReturnType>(result);
+		const bool valid = WithConstantParameters<SamplerType>(state, args, result, [&](auto... params) {
+			FillUniformOpen01(uniforms, count);
+			for (idx_t i = 0; i < count; i++) {
+				results[i] = ReturnType(SamplerType::template Transform<Math>(uniforms[i], params...));
+			}
+		});
+		if (valid && count == 1) {
 			result.SetVectorType(VectorType::CONSTANT_VECTOR);
-			ConstantVector::SetNull(result, true);
-			return;
 		}
+		return;
+	}
 
-		const auto dist_param1 = ConstantVector::GetData<DistParam1>(dist_param1_vector)[0];
-		const auto call_param = ConstantVector::GetData<CallParam>(call_param_vector)[0];
-
-		// Create distribution once for constant case
-		distribution_traits<DistributionType>::ValidateParameters(dist_param1);
-		DistributionType dist(dist_param1);
+	stats.PerRowPath();
+	FillUniformOpen01(uniforms, count);
+	const bool has_invalid_rows = CheckParameterVectors<SamplerType>(state, args);
+	DistributionColumns<SamplerType> columns(args, 0);
+	const auto results = FlatVector::GetData<ReturnType>(result);
+	columns.ForEachRow(
+	    count,
+	    [&](idx_t i, auto... params) {
+		    if (has_invalid_rows && !traits::ParametersValid(params...)) {
+			    FlatVector::SetNull(result, i, true);
+			    return;
+		    }
+		    results[i] = ReturnType(SamplerType::template Transform<Math>(uniforms[i], params...));
+	    },
+	    [&](idx_t i) { FlatVector::SetNull(result, i, true); });
+}
 
-		result.SetVectorType(VectorType::CONSTANT_VECTOR);
-		auto result_data = ConstantVector::GetData<ReturnType>(result);
-		result_data[0] = op(dist, call_param);
-		return;
+// SampleInverseTransform with the C library's functions, or under stochastic_precision 'fast'
+// with the branch-free ones of FastTransformMath, which let the transform loops vectorize.
+template <typename SamplerType, typename ReturnType>
+inline void DistributionSampleInverseTransform(DataChunk &args, ExpressionState &state, Vector &result) {
+	if (StochasticFunctionLocalState::UseFastPrecision(state)) {
+		SampleInverseTransform<SamplerType, ReturnType, FastTransformMath>(args, state, result);
+	} else {
+		SampleInverseTransform<SamplerType, ReturnType, LibraryTransformMath>(args, state, result);
 	}
+}
 
-	// Handle distribution parameter constant, call parameter varying
-	if (dist_param1_vector.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-		if (ConstantVector::IsNull(dist_param1_vector)) {
-			result.SetVectorType(VectorType::CONSTANT_VECTOR);
-			ConstantVector::SetNull(result, true);
+// Calls SamplerType::SampleBatch(count, params[0], ..., out) with the array of each parameter.
+template <typename SamplerType, typename SampleType, size_t... P>
+inline void SampleBatchColumns(idx_t count, double (*params)[STANDARD_VECTOR_SIZE], SampleType *out,
+                               std::index_sequence<P...>) {
+	SamplerType::SampleBatch(count, params[P]..., out);
+}
+
+// Sampling through a batch sampler (see batch_samplers.hpp). The parameters of the rows to
+// sample are gathered into flat arrays, leaving out rows with NULL or, in 'null' error mode,
+// invalid parameters, and the sampler draws all of them in one call.
+template <typename SamplerType, typename ReturnType>
+inline void DistributionSampleBatch(DataChunk &args, ExpressionState &state, Vector &result) {
+	using traits = distribution_traits<SamplerType>;
+	constexpr idx_t PARAM_COUNT = traits::param_names.size();
+
+	const idx_t count = args.size();
+	StochasticStatsScope stats(state, count);
+
+	double params[PARAM_COUNT][STANDARD_VECTOR_SIZE];
+	typename batch_sample_type<SamplerType>::type samples[STANDARD_VECTOR_SIZE];
+
+	auto sample = [&](idx_t sample_count) {
+		SampleBatchColumns<SamplerType>(sample_count, params, samples, std::make_index_sequence<PARAM_COUNT>());
+	};
+
+	if (ConstantParameterVectors<SamplerType>(args)) {
+		stats.ConstantPath();
+		const bool valid = WithConstantParameters<SamplerType>(state, args, result, [&](auto... constants) {
+			if constexpr (has_constant_sample_batch_v<SamplerType>) {
+				SamplerType::SampleConstant(count, double(constants)..., samples);
+			} else {
+				idx_t c = 0;
+				(std::fill_n(params[c++], count, double(constants)), ...);
+				sample(count);
+			}
+		});
+		if (!valid) {
 			return;
 		}
 
-		const auto dist_param1 = ConstantVector::GetData<DistParam1>(dist_param1_vector)[0];
-		distribution_traits<DistributionType>::ValidateParameters(dist_param1);
-		DistributionType dist(dist_param1);
-
-		UnaryExecutor::Execute<CallParam, ReturnType>(call_param_vector, result, args.size(),
-		                                              [&](CallParam call_param) { return op(dist, call_param); });
+		const auto results = FlatVector::GetData<ReturnType>(result);
+		for (idx_t i = 0; i < count; i++) {
+			results[i] = ReturnType(samples[i]);
+		}
+		if (count == 1) {
+			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+		}
 		return;
 	}
 
-	// Handle general case where both parameters vary
-	BinaryExecutor::Execute<DistParam1, CallParam, ReturnType>(
-	    dist_param1_vector, call_param_vector, result, args.size(), [&](DistParam1 dist_param1, CallParam call_param) {
-		    distribution_traits<DistributionType>::ValidateParameters(dist_param1);
-		    DistributionType dist(dist_param1);
-		    return op(dist, call_param);
-	    });
+	stats.PerRowPath();
+	const bool has_invalid_rows = CheckParameterVectors<SamplerType>(state, args);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto &result_validity = FlatVector::Validity(result);
+	const auto results = FlatVector::GetData<ReturnType>(result);
+
+	// Rows of the result that receive a sample, in sample order.
+	sel_t rows[STANDARD_VECTOR_SIZE];
+	idx_t sample_count = 0;
+	DistributionColumns<SamplerType>(args, 0).ForEachRow(
+	    count,
+	    [&](idx_t i, auto... values) {
+		    if (has_invalid_rows && !traits::ParametersValid(values...)) {
+			    result_validity.SetInvalid(i);
+			    return;
+		    }
+		    idx_t c = 0;
+		    ((params[c++][sample_count] = double(values)), ...);
+		    rows[sample_count++] = sel_t(i);
+	    },
+	    [&](idx_t i) { result_validity.SetInvalid(i); });
+
+	sample(sample_count);
+	for (idx_t j = 0; j < sample_count; j++) {
+		results[rows[j]] = ReturnType(samples[j]);
+	}
 }
 
-// Generic function template for single parameter distributions with single call parameter
-template <typename DistributionType, typename Func>
-inline void DistributionCallBinaryNone(DataChunk &args, ExpressionState &state, Vector &result, Func op) {
-	using DistParam1 = typename distribution_traits<DistributionType>::param1_t;
-	using DistParam2 = typename distribution_traits<DistributionType>::param2_t;
+// Which function of the cdf DistributionCallCdfKernel evaluates.
+enum class CdfFunction : uint8_t { CDF, CDF_COMPLEMENT, LOG_CDF, LOG_CDF_COMPLEMENT };
 
-	auto &dist_param1_vector = args.data[0];
-	auto &dist_param2_vector = args.data[1];
-
-	using FuncReturnType = decltype(op(std::declval<Vector &>(), std::declval<DistributionType &>()));
-	static_assert(std::is_same_v<FuncReturnType, std::pair<double, double>> ||
-	                  std::is_same_v<FuncReturnType, std::pair<int64_t, int64_t>> || std::is_scalar_v<FuncReturnType>,
-	              "Unsupported return type for distribution operation");
+// Calls KernelType::Evaluate(count, params[0], ..., x, ...) with the array of each parameter.
+template <typename KernelType, size_t... P>
+inline idx_t EvaluateCdfKernelColumns(idx_t count, double (*params)[STANDARD_VECTOR_SIZE], const double *x, bool upper,
+                                      double max_shape, double *out, sel_t *fallback, std::index_sequence<P...>) {
+	return KernelType::Evaluate(count, params[P]..., x, upper, max_shape, out, fallback);
+}
 
-	// Handle constant vectors optimization
-	if (dist_param1_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
-	    dist_param2_vector.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+// The distribution of row j of the parameter arrays gathered for a kernel.
+template <typename DistributionType, size_t... P>
+inline DistributionType DistributionFromColumns(double (*params)[STANDARD_VECTOR_SIZE], idx_t j,
+                                                std::index_sequence<P...>) {
+	return DistributionType(params[P][j]...);
+}
 
-		if (ConstantVector::IsNull(dist_param1_vector) || ConstantVector::IsNull(dist_param2_vector)) {
-			result.SetVectorType(VectorType::CONSTANT_VECTOR);
-			ConstantVector::SetNull(result, true);
+// Functions of the cdf evaluated by a special function kernel (see special_functions.hpp). The
+// parameters and x of the rows are gathered into flat arrays as for DistributionSampleBatch and
+// the kernel evaluates them in one call. The rows it leaves, and logarithms of tails that
+// underflow, are evaluated by op on a distribution built for the row. The kernels are about three
+// digits less accurate than boost::math, so the families call this only for stochastic_precision
+// 'fast'.
+template <typename DistributionType, typename KernelType, typename Func>
+inline void DistributionCallCdfKernel(DataChunk &args, ExpressionState &state, Vector &result, CdfFunction function,
+                                      Func op) {
+	using traits = distribution_traits<DistributionType>;
+	constexpr idx_t PARAM_COUNT = traits::param_names.size();
+	const auto param_sequence = std::make_index_sequence<PARAM_COUNT>();
+
+	const idx_t count = args.size();
+	auto &x_vector = args.data[PARAM_COUNT];
+	StochasticStatsScope stats(state, count);
+
+	const bool constant_params = ConstantParameterVectors<DistributionType>(args);
+	const bool constant = constant_params && x_vector.GetVectorType() == VectorType::CONSTANT_VECTOR;
+	bool has_invalid_rows = false;
+	if (constant_params) {
+		if (constant) {
+			stats.ConstantPath();
+		} else {
+			stats.ConstantParamsPath();
+		}
+		if (!WithConstantParameters<DistributionType>(state, args, result, [](auto...) {})) {
 			return;
 		}
+	} else {
+		stats.PerRowPath();
+		has_invalid_rows = CheckParameterVectors<DistributionType>(state, args);
+	}
 
-		const auto dist_param1 = ConstantVector::GetData<DistParam1>(dist_param1_vector)[0];
-		const auto dist_param2 = ConstantVector::GetData<DistParam2>(dist_param2_vector)[0];
-
-		// Create distribution once for constant case
-		distribution_traits<DistributionType>::ValidateParameters(dist_param1, dist_param2);
-		DistributionType dist(dist_param1, dist_param2);
+	UnifiedVectorFormat x_data;
+	x_vector.ToUnifiedFormat(count, x_data);
+	auto x_entries = UnifiedVectorFormat::GetData<double>(x_data);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto &result_validity = FlatVector::Validity(result);
+	const auto results = FlatVector::GetData<double>(result);
+
+	double params[PARAM_COUNT][STANDARD_VECTOR_SIZE];
+	double x[STANDARD_VECTOR_SIZE];
+	double values[STANDARD_VECTOR_SIZE];
+	// Rows of the result that receive a value, in evaluation order.
+	sel_t rows[STANDARD_VECTOR_SIZE];
+	idx_t row_count = 0;
+	DistributionColumns<DistributionType>(args, 0).ForEachRow(
+	    constant ? 1 : count,
+	    [&](idx_t i, auto... row_params) {
+		    const auto x_index = x_data.sel->get_index(i);
+		    if (!x_data.validity.RowIsValid(x_index) || (has_invalid_rows && !traits::ParametersValid(row_params...))) {
+			    result_validity.SetInvalid(i);
+			    return;
+		    }
+		    idx_t c = 0;
+		    ((params[c++][row_count] = double(row_params)), ...);
+		    x[row_count] = x_entries[x_index];
+		    rows[row_count++] = sel_t(i);
+	    },
+	    [&](idx_t i) { result_validity.SetInvalid(i); });
+
+	const bool upper = function == CdfFunction::CDF_COMPLEMENT || function == CdfFunction::LOG_CDF_COMPLEMENT;
+	const bool log = function == CdfFunction::LOG_CDF || function == CdfFunction::LOG_CDF_COMPLEMENT;
+	const double max_shape = SPECIAL_FUNCTION_FAST_MAX_SHAPE;
+	sel_t fallback[STANDARD_VECTOR_SIZE];
+	idx_t fallback_count =
+	    EvaluateCdfKernelColumns<KernelType>(row_count, params, x, upper, max_shape, values, fallback, param_sequence);
+	if (log) {
+		// The kernel lists its fallback rows in order; tails that underflowed to zero join them.
+		const idx_t kernel_fallback_count = fallback_count;
+		idx_t next_fallback = 0;
+		for (idx_t j = 0; j < row_count; j++) {
+			if (next_fallback < kernel_fallback_count && fallback[next_fallback] == j) {
+				next_fallback++;
+			} else if (values[j] == 0) {
+				fallback[fallback_count++] = sel_t(j);
+			} else {
+				values[j] = std::log(values[j]);
+			}
+		}
+	}
+	for (idx_t k = 0; k < fallback_count; k++) {
+		const auto j = fallback[k];
+		values[j] = op(DistributionFromColumns<DistributionType>(params, j, param_sequence), x[j]);
+	}
 
+	for (idx_t j = 0; j < row_count; j++) {
+		results[rows[j]] = values[j];
+	}
+	if (constant) {
 		result.SetVectorType(VectorType::CONSTANT_VECTOR);
-		if constexpr (std::is_same_v<FuncReturnType, std::pair<double, double>>) {
-			auto &result_data_children = ArrayVector::GetEntry(result);
-			auto data_ptr = FlatVector::GetData<double>(result_data_children);
-			auto array_result = op(result, dist);
-			data_ptr[0] = array_result.first;
-			data_ptr[1] = array_result.second;
-		} else if constexpr (std::is_same_v<FuncReturnType, std::pair<int64_t, int64_t>>) {
-			auto &result_data_children = ArrayVector::GetEntry(result);
-			auto data_ptr = FlatVector::GetData<int64_t>(result_data_children);
-			auto array_result = op(result, dist);
-			data_ptr[0] = array_result.first;
-			data_ptr[1] = array_result.second;
+	}
+}
+
+// Functions of a LIST(DOUBLE) argument, such as quantiles: op(dist, value) is applied to every
+// element of the row's list with the distribution built and its parameters checked once for the
+// row. The result is a list of the same length; NULL elements stay NULL. A DOUBLE result for lists
+// without NULLs is kept in the table cache, keyed by the parameters and the list, so repeating a
+// list of probabilities reuses it. Rows of a chunk with the same key copy the first one's values,
+// so the cache is consulted once per distinct key and chunk, never per row.
+template <typename DistributionType, typename Func>
+inline void DistributionCallList(DataChunk &args, ExpressionState &state, Vector &result, Func op) {
+	using traits = distribution_traits<DistributionType>;
+	using ReturnType = decltype(op(std::declval<DistributionType &>(), double()));
+
+	const idx_t count = args.size();
+	auto &list_vector = args.data[traits::param_names.size()];
+	StochasticStatsScope stats(state, count);
+
+	const bool constant_params = ConstantParameterVectors<DistributionType>(args);
+	const bool constant = constant_params && list_vector.GetVectorType() == VectorType::CONSTANT_VECTOR;
+	bool has_invalid_rows = false;
+	if (constant_params) {
+		if (constant) {
+			stats.ConstantPath();
 		} else {
-			auto result_data = ConstantVector::GetData<FuncReturnType>(result);
-			result_data[0] = op(result, dist);
+			stats.ConstantParamsPath();
 		}
-		return;
+		if (!WithConstantParameters<DistributionType>(state, args, result, [](auto...) {})) {
+			return;
+		}
+	} else {
+		stats.PerRowPath();
+		has_invalid_rows = CheckParameterVectors<DistributionType>(state, args);
 	}
 
-	// We need to specialize here because GenericExecutor doesn't support std::pair
-	// as a return type into an array.
-	if constexpr (std::is_same_v<FuncReturnType, std::pair<double, double>>) {
-		UnifiedVectorFormat dist_param1_data;
-		UnifiedVectorFormat dist_param2_data;
+	UnifiedVectorFormat list_data;
+	UnifiedVectorFormat element_data;
+	list_vector.ToUnifiedFormat(count, list_data);
+	auto &elements = ListVector::GetEntry(list_vector);
+	elements.ToUnifiedFormat(ListVector::GetListSize(list_vector), element_data);
+	auto list_entries = UnifiedVectorFormat::GetData<list_entry_t>(list_data);
+	auto element_entries = UnifiedVectorFormat::GetData<double>(element_data);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto &result_validity = FlatVector::Validity(result);
+	auto result_entries = FlatVector::GetData<list_entry_t>(result);
+	auto &result_elements = ListVector::GetEntry(result);
+	idx_t offset = ListVector::GetListSize(result);
+	const auto cache = GetStochasticCache(state);
+	// The offset in the result elements of the first row with each cache key.
+	std::unordered_map<StochasticCacheKey, idx_t, StochasticCacheKeyHash> chunk_offsets;
+
+	DistributionColumns<DistributionType>(args, 0).ForEachRow(
+	    constant ? 1 : count,
+	    [&](idx_t i, auto... params) {
+		    const auto list_index = list_data.sel->get_index(i);
+		    if (!list_data.validity.RowIsValid(list_index) ||
+		        (has_invalid_rows && !traits::ParametersValid(params...))) {
+			    result_validity.SetInvalid(i);
+			    return;
+		    }
+		    const auto &list = list_entries[list_index];
+		    const DistributionType dist(params...);
+		    ListVector::Reserve(result, offset + list.length);
+		    auto values = FlatVector::GetData<ReturnType>(result_elements) + offset;
+		    auto &values_validity = FlatVector::Validity(result_elements);
+		    auto fill = [&](ReturnType *out) {
+			    for (idx_t j = 0; j < list.length; j++) {
+				    const auto element_index = element_data.sel->get_index(list.offset + j);
+				    if (!element_data.validity.RowIsValid(element_index)) {
+					    values_validity.SetInvalid(offset + j);
+					    continue;
+				    }
+				    out[j] = op(dist, element_entries[element_index]);
+			    }
+		    };
+		    bool cached = false;
+		    if constexpr (std::is_same<ReturnType, double>::value) {
+			    if (cache && element_data.validity.AllValid()) {
+				    auto key = MakeStochasticCacheKey(state);
+				    (key.Add(params), ...);
+				    for (idx_t j = 0; j < list.length; j++) {
+					    key.Add(element_entries[element_data.sel->get_index(list.offset + j)]);
+				    }
+				    const auto entry = chunk_offsets.emplace(key, offset);
+				    if (entry.second) {
+					    CachedTable(*cache, std::move(key), list.length, values, fill);
+				    } else {
+					    const auto first = FlatVector::GetData<ReturnType>(result_elements) + entry.first->second;
+					    std::copy(first, first + list.length, values);
+				    }
+				    cached = true;
+			    }
+		    }
+		    if (!cached) {
+			    fill(values);
+		    }
+		    result_entries[i] = list_entry_t(offset, list.length);
+		    offset += list.length;
+	    },
+	    [&](idx_t i) { result_validity.SetInvalid(i); });
+	ListVector::SetListSize(result, offset);
+	if (constant) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
 
-		dist_param1_vector.ToUnifiedFormat(args.size(), dist_param1_data);
-		dist_param2_vector.ToUnifiedFormat(args.size(), dist_param2_data);
+// The fields of dist_<name>_summary, all DOUBLE.
+static const char *const DISTRIBUTION_SUMMARY_FIELDS[] = {"mean",     "variance", "stddev", "skewness",
+                                                          "kurtosis", "median",   "mode"};
+static constexpr idx_t DISTRIBUTION_SUMMARY_FIELD_COUNT = 7;
 
-		result.SetVectorType(VectorType::FLAT_VECTOR);
+static inline LogicalType DistributionSummaryType() {
+	child_list_t<LogicalType> children;
+	for (auto name : DISTRIBUTION_SUMMARY_FIELDS) {
+		children.emplace_back(name, LogicalType::DOUBLE);
+	}
+	return LogicalType::STRUCT(std::move(children));
+}
 
-		auto &result_data_children = ArrayVector::GetEntry(result);
-		auto result_data = FlatVector::GetData<double>(result_data_children);
-
-		if (!dist_param1_data.validity.AllValid() || !dist_param2_data.validity.AllValid()) {
-			auto result_validity = FlatVector::Validity(result);
-			for (idx_t i = 0; i < args.size(); i++) {
-				auto dist_param1_index = dist_param1_data.sel->get_index(i);
-				auto dist_param2_index = dist_param2_data.sel->get_index(i);
-				if (dist_param1_data.validity.RowIsValid(dist_param1_index) &&
-				    dist_param2_data.validity.RowIsValid(dist_param2_index)) {
-					auto dist_param1_entry =
-					    UnifiedVectorFormat::GetData<DistParam1>(dist_param1_data)[dist_param1_index];
-					auto dist_param2_entry =
-					    UnifiedVectorFormat::GetData<DistParam2>(dist_param2_data)[dist_param2_index];
-
-					distribution_traits<DistributionType>::ValidateParameters(dist_param1_entry, dist_param2_entry);
-					DistributionType dist(dist_param1_entry, dist_param2_entry);
-					auto op_result = op(result, dist);
-					result_data[i * 2] = op_result.first;
-					result_data[i * 2 + 1] = op_result.second;
-				} else {
-					result_validity.SetInvalid(i);
-				}
-			}
-		} else {
-			auto dist_param1_entries = UnifiedVectorFormat::GetData<DistParam1>(dist_param1_data);
-			auto dist_param2_entries = UnifiedVectorFormat::GetData<DistParam2>(dist_param2_data);
-			for (idx_t i = 0; i < args.size(); i++) {
-				auto dist_param1_entry = dist_param1_entries[dist_param1_data.sel->get_index(i)];
-				auto dist_param2_entry = dist_param2_entries[dist_param2_data.sel->get_index(i)];
-				distribution_traits<DistributionType>::ValidateParameters(dist_param1_entry, dist_param2_entry);
-				DistributionType dist(dist_param1_entry, dist_param2_entry);
-				auto op_result = op(result, dist);
-				result_data[i * 2] = op_result.first;
-				result_data[i * 2 + 1] = op_result.second;
-			}
+// Writes the summary fields of dist to out; returns a mask of the fields that are defined. Moments
+// the parameters leave undefined, for which boost::math raises a domain error (the variance of a
+// Student's t with df <= 2, say), are left out rather than failing the row. HAS_MOMENTS is false for
+// the Cauchy distribution, whose boost::math moment functions do not compile.
+template <bool HAS_MOMENTS, typename DistributionType>
+static uint32_t DistributionSummary(const DistributionType &dist, double *out) {
+	uint32_t defined = 0;
+	auto field = [&](idx_t index, auto func) {
+		try {
+			out[index] = double(func());
+			defined |= 1u << index;
+		} catch (const std::domain_error &) {
+		}
+	};
+	if constexpr (HAS_MOMENTS) {
+		// Unqualified, so argument-dependent lookup at instantiation also finds overloads declared
+		// after this template, such as the hypergeometric mean of hypergeometric_moments.hpp.
+		using boost::math::mean;
+		field(0, [&]() { return mean(dist); });
+		field(1, [&]() { return boost::math::variance(dist); });
+		// The standard deviation is the square root of the variance just computed.
+		if (defined & (1u << 1)) {
+			out[2] = std::sqrt(out[1]);
+			defined |= 1u << 2;
 		}
-	} else if constexpr (std::is_same_v<FuncReturnType, std::pair<int64_t, int64_t>>) {
-		UnifiedVectorFormat dist_param1_data;
-		UnifiedVectorFormat dist_param2_data;
+		field(3, [&]() { return boost::math::skewness(dist); });
+		field(4, [&]() { return boost::math::kurtosis(dist); });
+	}
+	field(5, [&]() { return boost::math::median(dist); });
+	field(6, [&]() { return boost::math::mode(dist); });
+	return defined;
+}
 
-		dist_param1_vector.ToUnifiedFormat(args.size(), dist_param1_data);
-		dist_param2_vector.ToUnifiedFormat(args.size(), dist_param2_data);
+// dist_<name>_summary(params...): the moments, median and mode of the distribution as one STRUCT
+// (see DistributionSummaryType), with the parameters checked and the distribution built once per
+// row instead of once per property function.
+template <typename DistributionType, bool HAS_MOMENTS = true>
+inline void DistributionCallSummary(DataChunk &args, ExpressionState &state, Vector &result) {
+	using traits = distribution_traits<DistributionType>;
 
-		result.SetVectorType(VectorType::FLAT_VECTOR);
+	const idx_t count = args.size();
+	StochasticStatsScope stats(state, count);
 
-		auto &result_data_children = ArrayVector::GetEntry(result);
-		auto result_data = FlatVector::GetData<int64_t>(result_data_children);
-
-		if (!dist_param1_data.validity.AllValid() || !dist_param2_data.validity.AllValid()) {
-			auto result_validity = FlatVector::Validity(result);
-			for (idx_t i = 0; i < args.size(); i++) {
-				auto dist_param1_index = dist_param1_data.sel->get_index(i);
-				auto dist_param2_index = dist_param2_data.sel->get_index(i);
-				if (dist_param1_data.validity.RowIsValid(dist_param1_index) &&
-				    dist_param2_data.validity.RowIsValid(dist_param2_index)) {
-					auto dist_param1_entry =
-					    UnifiedVectorFormat::GetData<DistParam1>(dist_param1_data)[dist_param1_index];
-					auto dist_param2_entry =
-					    UnifiedVectorFormat::GetData<DistParam2>(dist_param2_data)[dist_param2_index];
-
-					distribution_traits<DistributionType>::ValidateParameters(dist_param1_entry, dist_param2_entry);
-					DistributionType dist(dist_param1_entry, dist_param2_entry);
-					auto op_result = op(result, dist);
-					result_data[i * 2] = op_result.first;
-					result_data[i * 2 + 1] = op_result.second;
-				} else {
-					result_validity.SetInvalid(i);
-				}
-			}
-		} else {
-			auto dist_param1_entries = UnifiedVectorFormat::GetData<DistParam1>(dist_param1_data);
-			auto dist_param2_entries = UnifiedVectorFormat::GetData<DistParam2>(dist_param2_data);
-			for (idx_t i = 0; i < args.size(); i++) {
-				auto dist_param1_entry = dist_param1_entries[dist_param1_data.sel->get_index(i)];
-				auto dist_param2_entry = dist_param2_entries[dist_param2_data.sel->get_index(i)];
-				distribution_traits<DistributionType>::ValidateParameters(dist_param1_entry, dist_param2_entry);
-				DistributionType dist(dist_param1_entry, dist_param2_entry);
-				auto op_result = op(result, dist);
-				result_data[i * 2] = op_result.first;
-				result_data[i * 2 + 1] = op_result.second;
-			}
+	const bool constant = ConstantParameterVectors<DistributionType>(args);
+	bool has_invalid_rows = false;
+	if (constant) {
+		stats.ConstantPath();
+		if (!WithConstantParameters<DistributionType>(state, args, result, [](auto...) {})) {
+			return;
 		}
 	} else {
-		BinaryExecutor::Execute<DistParam1, DistParam2, FuncReturnType>(
-		    dist_param1_vector, dist_param2_vector, result, args.size(),
-		    [&](DistParam1 dist_param1, DistParam2 dist_param2) {
-			    distribution_traits<DistributionType>::ValidateParameters(dist_param1, dist_param2);
-			    DistributionType dist(dist_param1, dist_param2);
-			    return op(result, dist);
-		    });
+		stats.PerRowPath();
+		has_invalid_rows = CheckParameterVectors<DistributionType>(state, args);
 	}
-}
 
-template <typename DistributionType, typename Func>
-inline void DistributionCallUnaryNone(DataChunk &args, ExpressionState &state, Vector &result, Func op) {
-	using DistParam1 = typename distribution_traits<DistributionType>::param1_t;
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto &fields = StructVector::GetEntries(result);
+	double *field_data[DISTRIBUTION_SUMMARY_FIELD_COUNT];
+	for (idx_t f = 0; f < DISTRIBUTION_SUMMARY_FIELD_COUNT; f++) {
+		field_data[f] = FlatVector::GetData<double>(*fields[f]);
+	}
 
-	auto &dist_param1_vector = args.data[0];
+	DistributionColumns<DistributionType>(args, 0).ForEachRow(
+	    constant ? 1 : count,
+	    [&](idx_t i, auto... params) {
+		    if (has_invalid_rows && !traits::ParametersValid(params...)) {
+			    FlatVector::SetNull(result, i, true);
+			    return;
+		    }
+		    double values[DISTRIBUTION_SUMMARY_FIELD_COUNT];
+		    const uint32_t defined = DistributionSummary<HAS_MOMENTS>(DistributionType(params...), values);
+		    for (idx_t f = 0; f < DISTRIBUTION_SUMMARY_FIELD_COUNT; f++) {
+			    if (defined & (1u << f)) {
+				    field_data[f][i] = values[f];
+			    } else {
+				    FlatVector::SetNull(*fields[f], i, true);
+			    }
+		    }
+	    },
+	    [&](idx_t i) { FlatVector::SetNull(result, i, true); });
+	if (constant) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
 
-	using FuncReturnType = decltype(op(std::declval<Vector &>(), std::declval<DistributionType &>()));
-	static_assert(std::is_same_v<FuncReturnType, std::pair<double, double>> ||
-	                  std::is_same_v<FuncReturnType, std::pair<int64_t, int64_t>> || std::is_scalar_v<FuncReturnType>,
-	              "Unsupported return type for distribution operation");
+// The fields of dist_<name>_eval, all DOUBLE.
+static const char *const DISTRIBUTION_EVAL_FIELDS[] = {"pdf", "log_pdf", "cdf", "sf", "hazard"};
+static constexpr idx_t DISTRIBUTION_EVAL_FIELD_COUNT = 5;
 
-	// Handle constant vectors optimization
-	if (dist_param1_vector.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+static inline LogicalType DistributionEvalType() {
+	child_list_t<LogicalType> children;
+	for (auto name : DISTRIBUTION_EVAL_FIELDS) {
+		children.emplace_back(name, LogicalType::DOUBLE);
+	}
+	return LogicalType::STRUCT(std::move(children));
+}
 
-		if (ConstantVector::IsNull(dist_param1_vector)) {
-			result.SetVectorType(VectorType::CONSTANT_VECTOR);
-			ConstantVector::SetNull(result, true);
-			return;
-		}
+// Writes the eval fields of dist at x to out from one pdf and one survival function: the log
+// density is the log of the pdf while that is a normal number, the cdf is 1 - sf while sf <= 0.5
+// (within an ulp there) and the hazard is pdf / sf, as boost::math::hazard computes it. Returns
+// false when the hazard is not representable because sf underflowed where the pdf did not.
+template <typename DistributionType, typename CallParam>
+static bool DistributionEval(const DistributionType &dist, CallParam x, double *out) {
+	const double pdf = double(boost::math::pdf(dist, x));
+	const double sf = double(boost::math::cdf(boost::math::complement(dist, x)));
+	out[0] = pdf;
+	out[1] = pdf >= std::numeric_limits<double>::min() ? std::log(pdf) : double(boost::math::logpdf(dist, x));
+	out[2] = sf <= 0.5 ? 1 - sf : double(boost::math::cdf(dist, x));
+	out[3] = sf;
+	if (pdf == 0) {
+		out[4] = 0;
+		return true;
+	}
+	if (pdf > sf * std::numeric_limits<double>::max()) {
+		return false;
+	}
+	out[4] = pdf / sf;
+	return true;
+}
 
-		const auto dist_param1 = ConstantVector::GetData<DistParam1>(dist_param1_vector)[0];
+// dist_<name>_eval(params..., x): the pdf, log pdf, cdf, survival function and hazard at x as one
+// STRUCT (see DistributionEvalType), sharing the pdf and survival function between the fields.
+// A hazard that overflows is a NULL field; the other errors of the fields raise as they would
+// from the single functions.
+template <typename DistributionType, typename CallParam>
+inline void DistributionCallEval(DataChunk &args, ExpressionState &state, Vector &result) {
+	using traits = distribution_traits<DistributionType>;
 
-		// Create distribution once for constant case
-		distribution_traits<DistributionType>::ValidateParameters(dist_param1);
-		DistributionType dist(dist_param1);
+	const idx_t count = args.size();
+	auto &x_vector = args.data[traits::param_names.size()];
+	StochasticStatsScope stats(state, count);
 
-		result.SetVectorType(VectorType::CONSTANT_VECTOR);
-		if constexpr (std::is_same_v<FuncReturnType, std::pair<double, double>>) {
-			auto &result_data_children = ArrayVector::GetEntry(result);
-			auto data_ptr = FlatVector::GetData<double>(result_data_children);
-			auto array_result = op(result, dist);
-			data_ptr[0] = array_result.first;
-			data_ptr[1] = array_result.second;
-		} else if constexpr (std::is_same_v<FuncReturnType, std::pair<int64_t, int64_t>>) {
-			auto &result_data_children = ArrayVector::GetEntry(result);
-			auto data_ptr = FlatVector::GetData<int64_t>(result_data_children);
-			auto array_result = op(result, dist);
-			data_ptr[0] = array_result.first;
-			data_ptr[1] = array_result.second;
+	const bool constant_params = ConstantParameterVectors<DistributionType>(args);
+	const bool constant = constant_params && x_vector.GetVectorType() == VectorType::CONSTANT_VECTOR;
+	bool has_invalid_rows = false;
+	if (constant_params) {
+		if (constant) {
+			stats.ConstantPath();
 		} else {
-			auto result_data = ConstantVector::GetData<FuncReturnType>(result);
-			result_data[0] = op(result, dist);
+			stats.ConstantParamsPath();
 		}
-		return;
+		if (!WithConstantParameters<DistributionType>(state, args, result, [](auto...) {})) {
+			return;
+		}
+	} else {
+		stats.PerRowPath();
+		has_invalid_rows = CheckParameterVectors<DistributionType>(state, args);
 	}
 
-	// We need to specialize here because GenericExecutor doesn't support std::pair
-	// as a return type into an array.
-	if constexpr (std::is_same_v<FuncReturnType, std::pair<double, double>>) {
-		UnifiedVectorFormat dist_param1_data;
+	UnifiedVectorFormat x_data;
+	x_vector.ToUnifiedFormat(count, x_data);
+	auto x_entries = UnifiedVectorFormat::GetData<CallParam>(x_data);
 
-		dist_param1_vector.ToUnifiedFormat(args.size(), dist_param1_data);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto &fields = StructVector::GetEntries(result);
+	double *field_data[DISTRIBUTION_EVAL_FIELD_COUNT];
+	for (idx_t f = 0; f < DISTRIBUTION_EVAL_FIELD_COUNT; f++) {
+		field_data[f] = FlatVector::GetData<double>(*fields[f]);
+	}
+	auto &hazard_field = *fields[DISTRIBUTION_EVAL_FIELD_COUNT - 1];
+
+	DistributionColumns<DistributionType>(args, 0).ForEachRow(
+	    constant ? 1 : count,
+	    [&](idx_t i, auto... params) {
+		    const auto x_index = x_data.sel->get_index(i);
+		    if (!x_data.validity.RowIsValid(x_index) || (has_invalid_rows && !traits::ParametersValid(params...))) {
+			    FlatVector::SetNull(result, i, true);
+			    return;
+		    }
+		    double values[DISTRIBUTION_EVAL_FIELD_COUNT];
+		    const bool hazard_defined = DistributionEval(DistributionType(params...), x_entries[x_index], values);
+		    for (idx_t f = 0; f + 1 < DISTRIBUTION_EVAL_FIELD_COUNT; f++) {
+			    field_data[f][i] = values[f];
+		    }
+		    if (hazard_defined) {
+			    field_data[DISTRIBUTION_EVAL_FIELD_COUNT - 1][i] = values[DISTRIBUTION_EVAL_FIELD_COUNT - 1];
+		    } else {
+			    FlatVector::SetNull(hazard_field, i, true);
+		    }
+	    },
+	    [&](idx_t i) { FlatVector::SetNull(result, i, true); });
+	if (constant) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
 
-		result.SetVectorType(VectorType::FLAT_VECTOR);
+// Registers FLOAT overloads of the sampling, density, cumulative and quantile functions of a
+// continuous distribution. FloatDistributionType is the float instantiation of the boost::math
+// distribution, FloatSampleDistributionType the float boost::random distribution, inverse
+// transform sampler or batch sampler, or void when the distribution has no sampler.
+template <typename FloatDistributionType, typename FloatSampleDistributionType>
+void RegisterFloatOverloads(ExtensionLoader &loader, const string &distribution_text, const string &example_params,
+                            const string &example_x) {
+	vector<std::pair<string, LogicalType>> param_names_quantile = {{"p", LogicalType::FLOAT}};
+	vector<std::pair<string, LogicalType>> param_names_unary = {{"x", LogicalType::FLOAT}};
+
+	auto make_unary = [](auto func) {
+		return [func](DataChunk &args, ExpressionState &state, Vector &result) {
+			DistributionCallUnary<FloatDistributionType, float>(args, state, result, func);
+		};
+	};
+
+	auto example = [&](const string &name, const string &x) {
+		return name + "(" + example_params + ", " + x + ")";
+	};
+
+	if constexpr (!std::is_void_v<FloatSampleDistributionType>) {
+		RegisterFunction<FloatDistributionType>(
+		    loader, "sample", FunctionStability::VOLATILE, LogicalType::FLOAT,
+		    [](DataChunk &args, ExpressionState &state, Vector &result) {
+			    if constexpr (is_inverse_transform_sampler_v<FloatSampleDistributionType>) {
+				    DistributionSampleInverseTransform<FloatSampleDistributionType, float>(args, state, result);
+			    } else if constexpr (is_batch_sampler_v<FloatSampleDistributionType>) {
+				    DistributionSampleBatch<FloatSampleDistributionType, float>(args, state, result);
+			    } else {
+				    DistributionSample<FloatSampleDistributionType, float>(args, state, result);
+			    }
+		    },
+		    "Generates single precision random samples from the " + distribution_text + ".",
+		    "sample(" + example_params + ")");
+	}
 
-		auto &result_data_children = ArrayVector::GetEntry(result);
-		auto result_data = FlatVector::GetData<double>(result_data_children);
-
-		if (!dist_param1_data.validity.AllValid()) {
-			auto result_validity = FlatVector::Validity(result);
-			for (idx_t i = 0; i < args.size(); i++) {
-				auto dist_param1_index = dist_param1_data.sel->get_index(i);
-				if (dist_param1_data.validity.RowIsValid(dist_param1_index)) {
-					auto dist_param1_entry =
-					    UnifiedVectorFormat::GetData<DistParam1>(dist_param1_data)[dist_param1_index];
-
-					distribution_traits<DistributionType>::ValidateParameters(dist_param1_entry);
-					DistributionType dist(dist_param1_entry);
-					auto op_result = op(result, dist);
-					result_data[i * 2] = op_result.first;
-					result_data[i * 2 + 1] = op_result.second;
-				} else {
-					result_validity.SetInvalid(i);
-				}
-			}
-		} else {
-			auto dist_param1_entries = UnifiedVectorFormat::GetData<DistParam1>(dist_param1_data);
-			for (idx_t i = 0; i < args.size(); i++) {
-				auto dist_param1_entry = dist_param1_entries[dist_param1_data.sel->get_index(i)];
-				distribution_traits<DistributionType>::ValidateParameters(dist_param1_entry);
-				DistributionType dist(dist_param1_entry);
-				auto op_result = op(result, dist);
-				result_data[i * 2] = op_result.first;
-				result_data[i * 2 + 1] = op_result.second;
-			}
-		}
-	} else if constexpr (std::is_same_v<FuncReturnType, std::pair<int64_t, int64_t>>) {
-		UnifiedVectorFormat dist_param1_data;
+	RegisterFunction<FloatDistributionType>(
+	    loader, "pdf", FunctionStability::CONSISTENT, LogicalType::FLOAT,
+	    make_unary([](const auto &dist, auto x) -> float { return boost::math::pdf(dist, x); }),
+	    "Computes the probability density function (PDF) of the " + distribution_text + " in single precision.",
+	    example("pdf", example_x), param_names_unary);
+
+	RegisterFunction<FloatDistributionType>(
+	    loader, "log_pdf", FunctionStability::CONSISTENT, LogicalType::FLOAT,
+	    make_unary([](const auto &dist, auto x) -> float { return boost::math::logpdf(dist, x); }),
+	    "Computes the natural logarithm of the PDF of the " + distribution_text + " in single precision.",
+	    example("log_pdf", example_x), param_names_unary);
+
+	RegisterFunction<FloatDistributionType>(
+	    loader, "cdf", FunctionStability::CONSISTENT, LogicalType::FLOAT,
+	    make_unary([](const auto &dist, auto x) -> float { return boost::math::cdf(dist, x); }),
+	    "Computes the cumulative distribution function (CDF) of the " + distribution_text + " in single precision.",
+	    example("cdf", example_x), param_names_unary);
+
+	RegisterFunction<FloatDistributionType>(
+	    loader, "cdf_complement", FunctionStability::CONSISTENT, LogicalType::FLOAT,
+	    make_unary([](const auto &dist, auto x) -> float { return boost::math::cdf(boost::math::complement(dist, x)); }),
+	    "Computes the complementary CDF (1 - CDF) of the " + distribution_text + " in single precision.",
+	    example("cdf_complement", example_x), param_names_unary);
+
+	RegisterFunction<FloatDistributionType>(
+	    loader, "log_cdf", FunctionStability::CONSISTENT, LogicalType::FLOAT,
+	    make_unary([](const auto &dist, auto x) -> float { return boost::math::logcdf(dist, x); }),
+	    "Computes the natural logarithm of the CDF of the " + distribution_text + " in single precision.",
+	    example("log_cdf", example_x), param_names_unary);
+
+	RegisterFunction<FloatDistributionType>(
+	    loader, "log_cdf_complement", FunctionStability::CONSISTENT, LogicalType::FLOAT,
+	    make_unary(
+	        [](const auto &dist, auto x) -> float { return boost::math::logcdf(boost::math::complement(dist, x)); }),
+	    "Computes the natural logarithm of the complementary CDF of the " + distribution_text +
+	        " in single precision.",
+	    example("log_cdf_complement", example_x), param_names_unary);
+
+	RegisterFunction<FloatDistributionType>(
+	    loader, "quantile", FunctionStability::CONSISTENT, LogicalType::FLOAT,
+	    make_unary([](const auto &dist, auto p) -> float { return boost::math::quantile(dist, p); }),
+	    "Computes the quantile function (inverse CDF) of the " + distribution_text + " in single precision.",
+	    example("quantile", "0.95::FLOAT"), param_names_quantile);
+
+	RegisterFunction<FloatDistributionType>(
+	    loader, "quantile_complement", FunctionStability::CONSISTENT, LogicalType::FLOAT,
+	    make_unary(
+	        [](const auto &dist, auto p) -> float { return boost::math::quantile(boost::math::complement(dist, p)); }),
+	    "Computes the complementary quantile function of the " + distribution_text + " in single precision.",
+	    example("quantile_complement", "0.05::FLOAT"), param_names_quantile);
+}
 
-		dist_param1_vector.ToUnifiedFormat(args.size(), dist_param1_data);
+// dist_<name>(params...): the parameters as a DISTRIBUTION value. Invalid parameters raise, or give
+// NULL when stochastic_error_mode is 'null'. The generic functions check them again through the
+// family's function, since a DISTRIBUTION can also be cast from a struct.
+template <typename DistributionType>
+inline void DistributionConstruct(DataChunk &args, ExpressionState &state, Vector &result, uint8_t family) {
+	using traits = distribution_traits<DistributionType>;
+	constexpr idx_t PARAM_COUNT = traits::param_names.size();
+	static_assert(PARAM_COUNT <= 2, "a DISTRIBUTION value holds at most two parameters");
+
+	const idx_t count = args.size();
+	StochasticStatsScope stats(state, count);
+	const bool constant = ConstantParameterVectors<DistributionType>(args);
+	if (constant) {
+		stats.ConstantPath();
+	} else {
+		stats.PerRowPath();
+	}
 
-		result.SetVectorType(VectorType::FLAT_VECTOR);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto &children = StructVector::GetEntries(result);
+	auto families = FlatVector::GetData<uint8_t>(*children[0]);
+	double *param_values[2] = {FlatVector::GetData<double>(*children[1]), FlatVector::GetData<double>(*children[2])};
+	const bool null_on_invalid = StochasticFunctionLocalState::NullOnInvalid(state);
+
+	DistributionColumns<DistributionType>(args, 0).ForEachRow(
+	    constant ? 1 : count,
+	    [&](idx_t i, auto... params) {
+		    if (!traits::ParametersValid(params...)) {
+			    if (!null_on_invalid) {
+				    RaiseInvalidParameters<DistributionType>(state, params...);
+			    }
+			    FlatVector::SetNull(result, i, true);
+			    return;
+		    }
+		    families[i] = family;
+		    idx_t c = 0;
+		    ((param_values[c++][i] = double(params)), ...);
+		    // The parameters a family does not take are NULL.
+		    for (; c < 2; c++) {
+			    FlatVector::SetNull(*children[1 + c], i, true);
+		    }
+	    },
+	    [&](idx_t i) { FlatVector::SetNull(result, i, true); });
+	if (constant) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
 
-		auto &result_data_children = ArrayVector::GetEntry(result);
-		auto result_data = FlatVector::GetData<int64_t>(result_data_children);
-
-		if (!dist_param1_data.validity.AllValid()) {
-			auto result_validity = FlatVector::Validity(result);
-			for (idx_t i = 0; i < args.size(); i++) {
-				auto dist_param1_index = dist_param1_data.sel->get_index(i);
-				if (dist_param1_data.validity.RowIsValid(dist_param1_index)) {
-					auto dist_param1_entry =
-					    UnifiedVectorFormat::GetData<DistParam1>(dist_param1_data)[dist_param1_index];
-
-					distribution_traits<DistributionType>::ValidateParameters(dist_param1_entry);
-					DistributionType dist(dist_param1_entry);
-					auto op_result = op(result, dist);
-					result_data[i * 2] = op_result.first;
-					result_data[i * 2 + 1] = op_result.second;
-				} else {
-					result_validity.SetInvalid(i);
-				}
-			}
-		} else {
-			auto dist_param1_entries = UnifiedVectorFormat::GetData<DistParam1>(dist_param1_data);
-			for (idx_t i = 0; i < args.size(); i++) {
-				auto dist_param1_entry = dist_param1_entries[dist_param1_data.sel->get_index(i)];
-				distribution_traits<DistributionType>::ValidateParameters(dist_param1_entry);
-				DistributionType dist(dist_param1_entry);
-				auto op_result = op(result, dist);
-				result_data[i * 2] = op_result.first;
-				result_data[i * 2 + 1] = op_result.second;
-			}
-		}
-	} else {
-		UnaryExecutor::Execute<DistParam1, FuncReturnType>(
-		    dist_param1_vector, result, args.size(), [&](DistParam1 dist_param1) {
-			    distribution_traits<DistributionType>::ValidateParameters(dist_param1);
-			    DistributionType dist(dist_param1);
-			    return op(result, dist);
-		    });
+// Registers dist_<name>(params...) returning the DISTRIBUTION value of the family, which the
+// generic dist_pdf, dist_cdf, dist_quantile, dist_sample, ... dispatch back to its functions.
+template <typename DistributionType>
+void RegisterDistributionConstructor(ExtensionLoader &loader, const string &distribution_text,
+                                     const string &example_params) {
+	using traits = distribution_traits<DistributionType>;
+	const auto family = DistributionFamilyTag(traits::prefix);
+	if (family == DConstants::INVALID_INDEX) {
+		throw InternalException("stochastic: %s is missing from DISTRIBUTION_FAMILIES", traits::prefix);
 	}
+	const auto name = "dist_" + string(traits::prefix);
+	const auto param_types = traits::LogicalParamTypes();
+	StochasticStats::RegisterFunctionName(name);
+
+	auto function = ScalarFunction(
+	    name, param_types, DistributionValueType(),
+	    [family](DataChunk &args, ExpressionState &state, Vector &result) {
+		    DistributionConstruct<DistributionType>(args, state, result, uint8_t(family));
+	    },
+	    nullptr, nullptr, nullptr, StochasticFunctionLocalState::Init, LogicalTypeId::INVALID,
+	    FunctionStability::CONSISTENT, FunctionNullHandling::DEFAULT_NULL_HANDLING, nullptr);
+
+	CreateScalarFunctionInfo info(function);
+	info.on_conflict = OnCreateConflict::ALTER_ON_CONFLICT;
+	FunctionDescription desc;
+	desc.description = "Creates a DISTRIBUTION value holding the " + distribution_text +
+	                   " with the given parameters, which are checked when the value is built.";
+	desc.examples.push_back(name + "(" + example_params + ")");
+	desc.parameter_types = param_types;
+	desc.parameter_names = vector<string>(begin(traits::param_names), end(traits::param_names));
+	info.descriptions.push_back(desc);
+	loader.RegisterFunction(info);
 }
 
 void Load_gamma_distribution(DatabaseInstance &instance);
@@ -0,0 +1,367 @@
+#pragma once
+#include <boost/math/distributions/complement.hpp>
+#include <boost/math/distributions/detail/common_error_handling.hpp>
+#include <boost/math/distributions/detail/derived_accessors.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/policies/policy.hpp>
+#include <boost/math/special_functions/expm1.hpp>
+#include <boost/math/special_functions/log1p.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+// The Zipf distribution on {1, ..., n}: P(X = k) = k^-s / H(n, s), where H(n, s) = sum_{i=1}^{n} i^-s
+// is the generalized harmonic number. boost::math has no Zipf distribution; this one follows the
+// interface of its discrete distributions, so the executors and the derived accessors (hazard,
+// chf, median, ...) apply to it unchanged. The power sums behind the pmf, cdf and moments are
+// evaluated in O(1) with the Euler-Maclaurin formula, so nothing is tabulated even for n = 10^9.
+
+namespace boost {
+namespace math {
+
+namespace detail {
+
+// Power sums below this index (or the exponent's size, when larger) are added term by term; the
+// Euler-Maclaurin remainder past it is below double precision for exponents of moderate size.
+static constexpr double ZIPF_DIRECT_TERMS = 16;
+
+template <class RealType>
+RealType zipf_direct_end(RealType t) {
+	BOOST_MATH_STD_USING
+	return ZIPF_DIRECT_TERMS + 2 * ceil((std::min)(fabs(t), RealType(64)));
+}
+
+// sum_{i=a}^{b} i^-t for integers 1 <= a <= b and any real t.
+template <class RealType>
+RealType zipf_power_sum(RealType a, RealType b, RealType t) {
+	BOOST_MATH_STD_USING
+	const RealType direct_end = zipf_direct_end(t);
+	RealType sum = 0;
+	RealType i = a;
+	for (; i <= b && i < direct_end; i++) {
+		sum += pow(i, -t);
+	}
+	if (i > b) {
+		return sum;
+	}
+
+	// Euler-Maclaurin over i..b with f(x) = x^-t: the integral, the end point terms, and
+	// B_2j / (2j)! (f^(2j-1)(b) - f^(2j-1)(i)) for j = 1..4, where
+	// f^(2j-1)(x) = -t (t + 1) ... (t + 2j - 2) x^-(t + 2j - 1).
+	static constexpr double CORRECTIONS[] = {1.0 / 12, -1.0 / 720, 1.0 / 30240, -1.0 / 1209600};
+	const RealType log_ratio = log(b / i);
+	const RealType u = 1 - t;
+	sum += u == 0 ? log_ratio : pow(i, u) * expm1(u * log_ratio) / u;
+	sum += (pow(i, -t) + pow(b, -t)) / 2;
+	RealType derivative = -t;
+	for (int j = 0; j < 4; j++) {
+		const RealType order = t + 2 * j + 1;
+		sum += RealType(CORRECTIONS[j]) * derivative * (pow(b, -order) - pow(i, -order));
+		derivative *= (t + 2 * j + 1) * (t + 2 * j + 2);
+	}
+	return sum;
+}
+
+// log1p(x) / x and expm1(x) / x, continuous at 0.
+template <class RealType>
+RealType zipf_log1p_ratio(RealType x) {
+	BOOST_MATH_STD_USING
+	return fabs(x) > RealType(1e-8) ? log1p(x) / x : 1 - x * (RealType(0.5) - x * (RealType(1) / 3 - x / 4));
+}
+
+template <class RealType>
+RealType zipf_expm1_ratio(RealType x) {
+	BOOST_MATH_STD_USING
+	return fabs(x) > RealType(1e-8) ? expm1(x) / x : 1 + x / 2 * (1 + x / 3 * (1 + x / 4));
+}
+
+// The integral of x^-s from 1 to x, and its inverse, in the forms of Hormann and Derflinger that
+// stay accurate as s approaches 1. They approximate the power sums for the quantile searches and
+// are the hat of the rejection-inversion sampler (see batch_samplers.hpp).
+template <class RealType>
+RealType zipf_h_integral(RealType x, RealType s) {
+	BOOST_MATH_STD_USING
+	const RealType log_x = log(x);
+	return zipf_expm1_ratio((1 - s) * log_x) * log_x;
+}
+
+template <class RealType>
+RealType zipf_h_integral_inverse(RealType x, RealType s) {
+	BOOST_MATH_STD_USING
+	// Past -1 the integral has no inverse; the limit is the largest x the hat covers.
+	const RealType t = (std::max)(x * (1 - s), RealType(-1));
+	return exp(zipf_log1p_ratio(t) * x);
+}
+
+} // namespace detail
+
+template <class RealType = double, class Policy = policies::policy<>>
+class zipf_distribution {
+public:
+	using value_type = RealType;
+	using policy_type = Policy;
+
+	zipf_distribution(RealType n, RealType s) : n_(n), s_(s) {
+		BOOST_MATH_STD_USING
+		static const char *function = "boost::math::zipf_distribution<%1%>::zipf_distribution";
+		RealType result;
+		if (!(n >= 1 && n == floor(n) && (boost::math::isfinite)(n))) {
+			policies::raise_domain_error<RealType>(function, "Number of elements is %1%, but must be >= 1 !", n,
+			                                       Policy());
+		}
+		if (!detail::check_scale(function, s, &result, Policy())) {
+			return;
+		}
+		head_end_ = (std::min)(n_, detail::zipf_direct_end(s_) - 1);
+		head_ = detail::zipf_power_sum(RealType(1), head_end_, s_);
+		norm_ = head_end_ < n_ ? head_ + detail::zipf_power_sum(head_end_ + 1, n_, s_) : head_;
+	}
+
+	RealType elements() const {
+		return n_;
+	}
+	RealType exponent() const {
+		return s_;
+	}
+	// H(n, s), the sum of the weights k^-s.
+	RealType normalization() const {
+		return norm_;
+	}
+
+	// sum_{i=1}^{k} i^-s for 1 <= k <= n; the leading terms are reused from the constructor.
+	RealType partial_sum(RealType k) const {
+		if (k <= head_end_) {
+			return detail::zipf_power_sum(RealType(1), k, s_);
+		}
+		return head_ + detail::zipf_power_sum(head_end_ + 1, k, s_);
+	}
+
+	// sum_{i=k+1}^{n} i^-s for 0 <= k < n, summed directly so that small tails keep their accuracy.
+	RealType tail_sum(RealType k) const {
+		return detail::zipf_power_sum(k + 1, n_, s_);
+	}
+
+private:
+	RealType n_;
+	RealType s_;
+	RealType head_end_ = 0;
+	RealType head_ = 0;
+	RealType norm_ = 1;
+};
+
+template <class RealType, class Policy>
+inline const std::pair<RealType, RealType> range(const zipf_distribution<RealType, Policy> &dist) {
+	return std::pair<RealType, RealType>(RealType(1), dist.elements());
+}
+
+template <class RealType, class Policy>
+inline const std::pair<RealType, RealType> support(const zipf_distribution<RealType, Policy> &dist) {
+	return std::pair<RealType, RealType>(RealType(1), dist.elements());
+}
+
+namespace detail {
+
+template <class RealType, class Policy>
+bool zipf_check_x(const char *function, const RealType &x, RealType *result) {
+	if ((boost::math::isnan)(x)) {
+		*result = policies::raise_domain_error<RealType>(function, "Random variate x is %1%, but must not be NaN !", x,
+		                                                 Policy());
+		return false;
+	}
+	return true;
+}
+
+// Smallest k in [1, n] for which at(k) holds, where at is monotone in k, searched from guess by
+// doubling steps and then bisection, so an inexact guess costs a few evaluations more.
+template <class RealType, class Predicate>
+RealType zipf_search(RealType n, RealType guess, Predicate at) {
+	BOOST_MATH_STD_USING
+	RealType low = 0; // at(low) is false, with at(0) taken as false
+	RealType high = n; // at(high) is true, with at(n) taken as true
+	guess = (std::min)((std::max)(floor(guess), RealType(1)), n);
+	RealType step = 1;
+	if (at(guess)) {
+		high = guess;
+		while (high - step >= 1 && at(high - step)) {
+			high -= step;
+			step *= 2;
+		}
+		low = (std::max)(high - step, low);
+	} else {
+		low = guess;
+		while (low + step < n && !at(low + step)) {
+			low += step;
+			step *= 2;
+		}
+		high = (std::min)(low + step, high);
+	}
+	while (high - low > 1) {
+		const RealType middle = floor((low + high) / 2);
+		if (at(middle)) {
+			high = middle;
+		} else {
+			low = middle;
+		}
+	}
+	return high;
+}
+
+// The raw moment E[X^j] = H(n, s - j) / H(n, s).
+template <class RealType, class Policy>
+RealType zipf_raw_moment(const zipf_distribution<RealType, Policy> &dist, int j) {
+	return zipf_power_sum(RealType(1), dist.elements(), dist.exponent() - j) / dist.normalization();
+}
+
+} // namespace detail
+
+template <class RealType, class Policy>
+inline RealType pdf(const zipf_distribution<RealType, Policy> &dist, const RealType &x) {
+	BOOST_MATH_STD_USING
+	RealType result = 0;
+	if (!detail::zipf_check_x<RealType, Policy>("boost::math::pdf(zipf_distribution<%1%>&, %1%)", x, &result)) {
+		return result;
+	}
+	// The pmf is zero off the integers of the support.
+	if (x < 1 || x > dist.elements() || x != floor(x)) {
+		return 0;
+	}
+	return pow(x, -dist.exponent()) / dist.normalization();
+}
+
+template <class RealType, class Policy>
+inline RealType logpdf(const zipf_distribution<RealType, Policy> &dist, const RealType &x) {
+	BOOST_MATH_STD_USING
+	RealType result = 0;
+	if (!detail::zipf_check_x<RealType, Policy>("boost::math::logpdf(zipf_distribution<%1%>&, %1%)", x, &result)) {
+		return result;
+	}
+	if (x < 1 || x > dist.elements() || x != floor(x)) {
+		return -std::numeric_limits<RealType>::infinity();
+	}
+	return -dist.exponent() * log(x) - log(dist.normalization());
+}
+
+template <class RealType, class Policy>
+inline RealType cdf(const zipf_distribution<RealType, Policy> &dist, const RealType &x) {
+	BOOST_MATH_STD_USING
+	RealType result = 0;
+	if (!detail::zipf_check_x<RealType, Policy>("boost::math::cdf(zipf_distribution<%1%>&, %1%)", x, &result)) {
+		return result;
+	}
+	if (x < 1) {
+		return 0;
+	}
+	if (x >= dist.elements()) {
+		return 1;
+	}
+	return dist.partial_sum(floor(x)) / dist.normalization();
+}
+
+template <class RealType, class Policy>
+inline RealType cdf(const complemented2_type<zipf_distribution<RealType, Policy>, RealType> &c) {
+	BOOST_MATH_STD_USING
+	const auto &dist = c.dist;
+	const RealType x = c.param;
+	RealType result = 0;
+	if (!detail::zipf_check_x<RealType, Policy>("boost::math::cdf(zipf_distribution<%1%>&, %1%)", x, &result)) {
+		return result;
+	}
+	if (x < 1) {
+		return 1;
+	}
+	if (x >= dist.elements()) {
+		return 0;
+	}
+	return dist.tail_sum(floor(x)) / dist.normalization();
+}
+
+// The smallest k with cdf(k) >= p. The guess inverts the integral of x^-s from 1/2 to k + 1/2,
+// which approximates the partial sums closely enough that the search evaluates only a few.
+template <class RealType, class Policy>
+inline RealType quantile(const zipf_distribution<RealType, Policy> &dist, const RealType &p) {
+	RealType result = 0;
+	if (!detail::check_probability("boost::math::quantile(zipf_distribution<%1%>&, %1%)", p, &result, Policy())) {
+		return result;
+	}
+	const RealType s = dist.exponent();
+	const RealType norm = dist.normalization();
+	const RealType guess =
+	    detail::zipf_h_integral_inverse(p * norm + detail::zipf_h_integral(RealType(0.5), s), s) - RealType(0.5);
+	return detail::zipf_search(dist.elements(), guess,
+	                           [&](RealType k) { return k >= dist.elements() || dist.partial_sum(k) / norm >= p; });
+}
+
+// The smallest k with cdf(complement(k)) <= q, searched from the inverse of the integral of x^-s
+// from k + 1/2 to n + 1/2.
+template <class RealType, class Policy>
+inline RealType quantile(const complemented2_type<zipf_distribution<RealType, Policy>, RealType> &c) {
+	const auto &dist = c.dist;
+	const RealType q = c.param;
+	RealType result = 0;
+	if (!detail::check_probability("boost::math::quantile(const complemented2_type<zipf_distribution<%1%>, %1%>&)", q,
+	                               &result, Policy())) {
+		return result;
+	}
+	const RealType s = dist.exponent();
+	const RealType n = dist.elements();
+	const RealType norm = dist.normalization();
+	const RealType guess =
+	    detail::zipf_h_integral_inverse(detail::zipf_h_integral(n + RealType(0.5), s) - q * norm, s) - RealType(0.5);
+	return detail::zipf_search(n, guess, [&](RealType k) { return k >= n || dist.tail_sum(k) / norm <= q; });
+}
+
+template <class RealType, class Policy>
+inline RealType mean(const zipf_distribution<RealType, Policy> &dist) {
+	return detail::zipf_raw_moment(dist, 1);
+}
+
+template <class RealType, class Policy>
+inline RealType variance(const zipf_distribution<RealType, Policy> &dist) {
+	const RealType m1 = detail::zipf_raw_moment(dist, 1);
+	return detail::zipf_raw_moment(dist, 2) - m1 * m1;
+}
+
+template <class RealType, class Policy>
+inline RealType mode(const zipf_distribution<RealType, Policy> &) {
+	return 1;
+}
+
+// The central moments from the raw ones. They are undefined for n = 1, where the variance is 0.
+template <class RealType, class Policy>
+inline RealType skewness(const zipf_distribution<RealType, Policy> &dist) {
+	BOOST_MATH_STD_USING
+	const RealType m1 = detail::zipf_raw_moment(dist, 1);
+	const RealType m2 = detail::zipf_raw_moment(dist, 2);
+	const RealType m3 = detail::zipf_raw_moment(dist, 3);
+	const RealType variance = m2 - m1 * m1;
+	if (!(variance > 0)) {
+		return policies::raise_domain_error<RealType>("boost::math::skewness(zipf_distribution<%1%>&)",
+		                                              "The skewness is undefined for a variance of %1% !", variance,
+		                                              Policy());
+	}
+	return (m3 - 3 * m1 * m2 + 2 * m1 * m1 * m1) / (variance * sqrt(variance));
+}
+
+template <class RealType, class Policy>
+inline RealType kurtosis(const zipf_distribution<RealType, Policy> &dist) {
+	const RealType m1 = detail::zipf_raw_moment(dist, 1);
+	const RealType m2 = detail::zipf_raw_moment(dist, 2);
+	const RealType m3 = detail::zipf_raw_moment(dist, 3);
+	const RealType m4 = detail::zipf_raw_moment(dist, 4);
+	const RealType variance = m2 - m1 * m1;
+	if (!(variance > 0)) {
+		return policies::raise_domain_error<RealType>("boost::math::kurtosis(zipf_distribution<%1%>&)",
+		                                              "The kurtosis is undefined for a variance of %1% !", variance,
+		                                              Policy());
+	}
+	return (m4 - 4 * m1 * m3 + 6 * m1 * m1 * m2 - 3 * m1 * m1 * m1 * m1) / (variance * variance);
+}
+
+template <class RealType, class Policy>
+inline RealType kurtosis_excess(const zipf_distribution<RealType, Policy> &dist) {
+	return kurtosis(dist) - 3;
+}
+
+} // namespace math
+} // namespace boost
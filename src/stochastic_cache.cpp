@@ -0,0 +1,160 @@
+#include "stochastic_cache.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+
+namespace duckdb {
+
+static uint64_t TableBytes(const StochasticTable &table) {
+	return table->size() * sizeof(double);
+}
+
+StochasticTable StochasticCache::Get(const StochasticCacheKey &key) {
+	auto &shard = GetShard(key);
+	std::lock_guard<std::mutex> guard(shard.lock);
+	auto entry = shard.entries.find(key);
+	if (entry == shard.entries.end()) {
+		shard.misses++;
+		return nullptr;
+	}
+	shard.recency.splice(shard.recency.begin(), shard.recency, entry->second.recency);
+	shard.hits++;
+	return entry->second.table;
+}
+
+void StochasticCache::Shard::Erase(EntryMap::iterator entry) {
+	bytes -= TableBytes(entry->second.table);
+	recency.erase(entry->second.recency);
+	entries.erase(entry);
+}
+
+void StochasticCache::Shard::EvictTo(uint64_t limit, uint64_t reserve) {
+	while (!recency.empty() && bytes + reserve > limit) {
+		Erase(entries.find(*recency.back()));
+		evictions++;
+	}
+}
+
+void StochasticCache::SetCapacity(idx_t new_capacity) {
+	if (capacity.exchange(new_capacity, std::memory_order_relaxed) <= new_capacity) {
+		return;
+	}
+	const auto limit = new_capacity / SHARD_COUNT;
+	for (auto &shard : shards) {
+		std::lock_guard<std::mutex> guard(shard.lock);
+		const auto bytes_before = shard.bytes;
+		shard.EvictTo(limit, 0);
+		bytes -= bytes_before - shard.bytes;
+	}
+}
+
+void StochasticCache::Put(StochasticCacheKey key, StochasticTable table) {
+	const auto limit = capacity.load(std::memory_order_relaxed) / SHARD_COUNT;
+	const auto table_bytes = TableBytes(table);
+	auto &shard = GetShard(key);
+	std::lock_guard<std::mutex> guard(shard.lock);
+	const auto bytes_before = shard.bytes;
+	auto existing = shard.entries.find(key);
+	if (existing != shard.entries.end()) {
+		shard.Erase(existing);
+	}
+	const bool keep = table_bytes <= limit;
+	shard.EvictTo(limit, keep ? table_bytes : 0);
+	if (keep) {
+		shard.bytes += table_bytes;
+		auto inserted = shard.entries.emplace(std::move(key), Entry {std::move(table), shard.recency.end()}).first;
+		shard.recency.push_front(&inserted->first);
+		inserted->second.recency = shard.recency.begin();
+	}
+	if (shard.bytes >= bytes_before) {
+		bytes += shard.bytes - bytes_before;
+	} else {
+		bytes -= bytes_before - shard.bytes;
+	}
+}
+
+StochasticCacheStats StochasticCache::Stats() {
+	StochasticCacheStats stats;
+	for (auto &shard : shards) {
+		std::lock_guard<std::mutex> guard(shard.lock);
+		stats.entries += shard.entries.size();
+		stats.bytes += shard.bytes;
+		stats.hits += shard.hits;
+		stats.misses += shard.misses;
+		stats.evictions += shard.evictions;
+	}
+	return stats;
+}
+
+optional_ptr<StochasticCache> GetStochasticCache(ExpressionState &state) {
+	auto local_state = StochasticFunctionLocalState::Get(state);
+	if (!local_state || local_state->cache_size == 0) {
+		return nullptr;
+	}
+	if (!local_state->cache) {
+		local_state->cache =
+		    ObjectCache::GetObjectCache(state.GetContext()).GetOrCreate<StochasticCache>(StochasticCache::ObjectType());
+		local_state->cache->SetCapacity(local_state->cache_size);
+	}
+	return local_state->cache.get();
+}
+
+StochasticCacheKey MakeStochasticCacheKey(ExpressionState &state) {
+	auto local_state = StochasticFunctionLocalState::Get(state);
+	StochasticCacheKey key;
+	key.function_id = local_state ? local_state->function_id : DConstants::INVALID_INDEX;
+	key.precision = local_state ? local_state->precision : StochasticPrecision::FULL;
+	return key;
+}
+
+struct StochasticCacheStatsGlobalState : public GlobalTableFunctionState {
+	StochasticCacheStats stats;
+	bool done = false;
+};
+
+static unique_ptr<FunctionData> StochasticCacheStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	names = {"entries", "bytes", "hits", "misses", "evictions"};
+	return_types = {LogicalType::UBIGINT, LogicalType::UBIGINT, LogicalType::UBIGINT, LogicalType::UBIGINT,
+	                LogicalType::UBIGINT};
+	return make_uniq<TableFunctionData>();
+}
+
+static unique_ptr<GlobalTableFunctionState> StochasticCacheStatsInit(ClientContext &context,
+                                                                     TableFunctionInitInput &input) {
+	auto result = make_uniq<StochasticCacheStatsGlobalState>();
+	auto cache = ObjectCache::GetObjectCache(context).Get<StochasticCache>(StochasticCache::ObjectType());
+	if (cache) {
+		result->stats = cache->Stats();
+	}
+	return std::move(result);
+}
+
+static void StochasticCacheStatsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<StochasticCacheStatsGlobalState>();
+	if (state.done) {
+		output.SetCardinality(0);
+		return;
+	}
+	output.SetValue(0, 0, Value::UBIGINT(state.stats.entries));
+	output.SetValue(1, 0, Value::UBIGINT(state.stats.bytes));
+	output.SetValue(2, 0, Value::UBIGINT(state.stats.hits));
+	output.SetValue(3, 0, Value::UBIGINT(state.stats.misses));
+	output.SetValue(4, 0, Value::UBIGINT(state.stats.evictions));
+	output.SetCardinality(1);
+	state.done = true;
+}
+
+void LoadStochasticCache(ExtensionLoader &loader) {
+	auto &config = DBConfig::GetConfig(loader.GetDatabaseInstance());
+	config.AddExtensionOption(STOCHASTIC_CACHE_SIZE_SETTING,
+	                          "Bytes of pmf and quantile tables kept across queries by the stochastic functions "
+	                          "(256 MiB by default); 0 disables the cache",
+	                          LogicalType::UBIGINT, Value::UBIGINT(STOCHASTIC_CACHE_DEFAULT_SIZE));
+
+	TableFunction cache_stats_function("stochastic_cache_stats", {}, StochasticCacheStatsFunction,
+	                                   StochasticCacheStatsBind, StochasticCacheStatsInit);
+	loader.RegisterFunction(cache_stats_function);
+}
+
+} // namespace duckdb
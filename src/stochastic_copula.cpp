@@ -0,0 +1,224 @@
+#include "stochastic_copula.hpp"
+#include "stochastic_multivariate_normal.hpp"
+#include "stochastic_distribution_type.hpp"
+#include "batch_samplers.hpp"
+#include "special_functions.hpp"
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include <boost/math/distributions/students_t.hpp>
+#include <atomic>
+
+namespace duckdb {
+
+static constexpr const char *COPULA_NAME = "copula_sample";
+
+// The largest deviation from 1 accepted on the diagonal of the correlation matrix.
+static constexpr double COPULA_DIAGONAL_TOLERANCE = 1e-9;
+static constexpr double INV_SQRT2 = 0.70710678118654752440;
+
+struct CopulaBindData : public FunctionData {
+	idx_t rows = 0;
+	shared_ptr<const CholeskyFactor> factor;
+	// The DISTRIBUTION of each column.
+	vector<Value> marginals;
+	// Degrees of freedom of the Student's t copula; 0 for the Gaussian copula.
+	double degrees_of_freedom = 0;
+
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<CopulaBindData>(*this);
+	}
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = other_p.Cast<CopulaBindData>();
+		return rows == other.rows && factor == other.factor && marginals == other.marginals &&
+		       degrees_of_freedom == other.degrees_of_freedom;
+	}
+};
+
+struct CopulaGlobalState : public GlobalTableFunctionState {
+	explicit CopulaGlobalState(idx_t rows) : rows(rows) {
+	}
+
+	idx_t rows;
+	// The first row of the next chunk; threads claim chunks from it.
+	std::atomic<idx_t> next {0};
+
+	idx_t MaxThreads() const override {
+		return rows / STANDARD_VECTOR_SIZE + 1;
+	}
+};
+
+// The buffers of one thread, and dist_quantile(marginal_j, #j) for every column j bound against
+// a chunk of uniforms, so the normals and the uniforms never leave these buffers.
+struct CopulaLocalState : public LocalTableFunctionState {
+	CopulaLocalState(ClientContext &context, const CopulaBindData &data)
+	    : normals(STANDARD_VECTOR_SIZE * data.marginals.size()), zeros(data.marginals.size(), 0) {
+		const idx_t dimension = data.marginals.size();
+		FunctionBinder binder(context);
+		for (idx_t j = 0; j < dimension; j++) {
+			vector<unique_ptr<Expression>> children;
+			children.push_back(make_uniq<BoundConstantExpression>(data.marginals[j]));
+			children.push_back(make_uniq<BoundReferenceExpression>(LogicalType::DOUBLE, j));
+			ErrorData error;
+			auto quantile = binder.BindScalarFunction(DEFAULT_SCHEMA, "dist_quantile", std::move(children), error);
+			if (!quantile) {
+				error.Throw();
+			}
+			quantiles.push_back(std::move(quantile));
+		}
+		executor = make_uniq<ExpressionExecutor>(context, quantiles);
+		uniforms.Initialize(context, vector<LogicalType>(dimension, LogicalType::DOUBLE));
+	}
+
+	vector<unique_ptr<Expression>> quantiles;
+	unique_ptr<ExpressionExecutor> executor;
+	// Row-major normals of a chunk, then the copula's uniforms one column per marginal.
+	vector<double> normals;
+	DataChunk uniforms;
+	vector<double> zeros;
+};
+
+// Quantile functions of unbounded marginals are infinite or raise at 0 and 1, which the cdfs
+// below only reach by rounding.
+static inline double ClampProbability(double u) {
+	return std::min(std::max(u, std::numeric_limits<double>::min()), 1 - std::numeric_limits<double>::epsilon() / 2);
+}
+
+// u = Phi(z) for each component of the correlated normals.
+static void GaussianCopulaUniforms(const double *normals, idx_t count, DataChunk &uniforms) {
+	const idx_t d = uniforms.ColumnCount();
+	for (idx_t j = 0; j < d; j++) {
+		auto u = FlatVector::GetData<double>(uniforms.data[j]);
+		for (idx_t i = 0; i < count; i++) {
+			u[i] = ClampProbability(0.5 * std::erfc(-normals[i * d + j] * INV_SQRT2));
+		}
+	}
+}
+
+// u = T_df(z sqrt(df / w)) with one chi-squared variate w per row shared by its components, which
+// gives the components of a row their common tail dependence.
+static void StudentTCopulaUniforms(const double *normals, idx_t count, double degrees_of_freedom,
+                                   DataChunk &uniforms) {
+	const idx_t d = uniforms.ColumnCount();
+	double dfs[STANDARD_VECTOR_SIZE];
+	double scales[STANDARD_VECTOR_SIZE];
+	double t[STANDARD_VECTOR_SIZE];
+	sel_t fallback[STANDARD_VECTOR_SIZE];
+	std::fill_n(dfs, count, degrees_of_freedom);
+	SampleChiSquared(count, dfs, scales);
+	for (idx_t i = 0; i < count; i++) {
+		scales[i] = std::sqrt(degrees_of_freedom / scales[i]);
+	}
+	const boost::math::students_t_distribution<double> dist(degrees_of_freedom);
+	for (idx_t j = 0; j < d; j++) {
+		auto u = FlatVector::GetData<double>(uniforms.data[j]);
+		for (idx_t i = 0; i < count; i++) {
+			t[i] = normals[i * d + j] * scales[i];
+		}
+		const idx_t fallback_count =
+		    students_t_cdf_kernel::Evaluate(count, dfs, t, false, SPECIAL_FUNCTION_MAX_SHAPE, u, fallback);
+		for (idx_t k = 0; k < fallback_count; k++) {
+			u[fallback[k]] = boost::math::cdf(dist, t[fallback[k]]);
+		}
+		for (idx_t i = 0; i < count; i++) {
+			u[i] = ClampProbability(u[i]);
+		}
+	}
+}
+
+static unique_ptr<FunctionData> CopulaBind(ClientContext &context, TableFunctionBindInput &input,
+                                           vector<LogicalType> &return_types, vector<string> &names) {
+	if (input.inputs[0].IsNull() || input.inputs[0].GetValue<int64_t>() < 0) {
+		throw InvalidInputException("copula: Number of samples must be >= 0");
+	}
+	const idx_t dimension = input.inputs.size() - 2;
+	if (dimension == 0) {
+		throw InvalidInputException("copula: At least one marginal distribution is required");
+	}
+	vector<double> correlation;
+	if (!MatrixValues(input.inputs[1], dimension, correlation)) {
+		throw InvalidInputException("copula: The correlation matrix must be %llu lists of %llu numbers without NULLs",
+		                            dimension, dimension);
+	}
+	for (idx_t i = 0; i < dimension; i++) {
+		if (!(std::abs(correlation[i * dimension + i] - 1) <= COPULA_DIAGONAL_TOLERANCE)) {
+			throw InvalidInputException("copula: The correlation matrix must have ones on its diagonal");
+		}
+	}
+	auto factor = make_shared_ptr<CholeskyFactor>();
+	if (!factor->Factor(correlation.data(), dimension)) {
+		throw InvalidInputException("copula: The correlation matrix must be symmetric positive semidefinite");
+	}
+
+	auto result = make_uniq<CopulaBindData>();
+	auto df = input.named_parameters.find("df");
+	if (df != input.named_parameters.end()) {
+		const double value = df->second.IsNull() ? -1 : df->second.GetValue<double>();
+		if (!(value > 0) || std::isinf(value)) {
+			throw InvalidInputException("copula: Degrees of freedom must be > 0 and finite was: " +
+			                            std::to_string(value));
+		}
+		result->degrees_of_freedom = value;
+	}
+	for (idx_t j = 0; j < dimension; j++) {
+		const auto &marginal = input.inputs[j + 2];
+		if (marginal.IsNull()) {
+			throw InvalidInputException("copula: Marginal distributions must not be NULL");
+		}
+		result->marginals.push_back(marginal);
+		names.push_back("x" + std::to_string(j + 1));
+		return_types.push_back(LogicalType::DOUBLE);
+	}
+	result->rows = idx_t(input.inputs[0].GetValue<int64_t>());
+	result->factor = std::move(factor);
+	return std::move(result);
+}
+
+static unique_ptr<GlobalTableFunctionState> CopulaInit(ClientContext &context, TableFunctionInitInput &input) {
+	return make_uniq<CopulaGlobalState>(input.bind_data->Cast<CopulaBindData>().rows);
+}
+
+static unique_ptr<LocalTableFunctionState> CopulaLocalInit(ExecutionContext &context, TableFunctionInitInput &input,
+                                                           GlobalTableFunctionState *global_state) {
+	return make_uniq<CopulaLocalState>(context.client, input.bind_data->Cast<CopulaBindData>());
+}
+
+// Per chunk: correlated standard normals by the Cholesky factor of corr, the copula's uniforms
+// from them, then each column's quantile function straight into the output.
+static void CopulaFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.bind_data->Cast<CopulaBindData>();
+	auto &state = data_p.global_state->Cast<CopulaGlobalState>();
+	auto &local = data_p.local_state->Cast<CopulaLocalState>();
+	const idx_t start = state.next.fetch_add(STANDARD_VECTOR_SIZE);
+	if (start >= state.rows) {
+		output.SetCardinality(0);
+		return;
+	}
+	const idx_t count = std::min<idx_t>(STANDARD_VECTOR_SIZE, state.rows - start);
+	const double *means[STANDARD_VECTOR_SIZE];
+	std::fill_n(means, count, local.zeros.data());
+	SampleMultivariateNormal(*data.factor, means, count, local.normals.data());
+
+	local.uniforms.Reset();
+	if (data.degrees_of_freedom > 0) {
+		StudentTCopulaUniforms(local.normals.data(), count, data.degrees_of_freedom, local.uniforms);
+	} else {
+		GaussianCopulaUniforms(local.normals.data(), count, local.uniforms);
+	}
+	local.uniforms.SetCardinality(count);
+	local.executor->Execute(local.uniforms, output);
+}
+
+void LoadCopula(ExtensionLoader &loader) {
+	TableFunction function(COPULA_NAME, {LogicalType::BIGINT, LogicalType::ANY}, CopulaFunction, CopulaBind,
+	                       CopulaInit, CopulaLocalInit);
+	function.varargs = DistributionValueType();
+	function.named_parameters["df"] = LogicalType::DOUBLE;
+	loader.RegisterFunction(function);
+}
+
+} // namespace duckdb
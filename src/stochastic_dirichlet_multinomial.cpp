@@ -0,0 +1,307 @@
+#include "stochastic_dirichlet_multinomial.hpp"
+#include "batch_samplers.hpp"
+#include "function_state.hpp"
+#include "stochastic_stats.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include <duckdb/parser/parsed_data/create_scalar_function_info.hpp>
+
+namespace duckdb {
+
+static constexpr const char *DIRICHLET_NAME = "dist_dirichlet_sample";
+static constexpr const char *MULTINOMIAL_NAME = "dist_multinomial_sample";
+
+// The largest deviation from 1 accepted for the sum of the multinomial probabilities.
+static constexpr double MULTINOMIAL_SUM_TOLERANCE = 1e-9;
+
+// The elements of a LIST(DOUBLE) argument in unified format.
+struct ListParameter {
+	ListParameter(Vector &list, idx_t count) {
+		list.ToUnifiedFormat(count, list_data);
+		auto &child = ListVector::GetEntry(list);
+		child.ToUnifiedFormat(ListVector::GetListSize(list), child_data);
+		entries = UnifiedVectorFormat::GetData<list_entry_t>(list_data);
+		values = UnifiedVectorFormat::GetData<double>(child_data);
+	}
+
+	UnifiedVectorFormat list_data;
+	UnifiedVectorFormat child_data;
+	const list_entry_t *entries;
+	const double *values;
+
+	// Appends the elements of row i to out; false, leaving out as it was, when the list or one of
+	// its elements is NULL.
+	bool Append(idx_t i, vector<double> &out) const {
+		const auto list_index = list_data.sel->get_index(i);
+		if (!list_data.validity.RowIsValid(list_index)) {
+			return false;
+		}
+		const auto &entry = entries[list_index];
+		const idx_t start = out.size();
+		for (idx_t k = 0; k < entry.length; k++) {
+			const auto index = child_data.sel->get_index(entry.offset + k);
+			if (!child_data.validity.RowIsValid(index)) {
+				out.resize(start);
+				return false;
+			}
+			out.push_back(values[index]);
+		}
+		return true;
+	}
+};
+
+// Rows with a NULL argument are NULL; rows with invalid parameters raise, or are NULL under
+// stochastic_error_mode = 'null'. Either way they keep an empty list entry in the result.
+static void SetNullRow(Vector &result, idx_t i, idx_t offset) {
+	FlatVector::GetData<list_entry_t>(result)[i] = list_entry_t(offset, 0);
+	FlatVector::SetNull(result, i, true);
+}
+
+static void RaiseOrSetNull(ExpressionState &state, bool null_on_invalid, const string &message, Vector &result,
+                           idx_t i, idx_t offset) {
+	if (!null_on_invalid) {
+		CountValidationFailure(state);
+		throw InvalidInputException(message);
+	}
+	SetNullRow(result, i, offset);
+}
+
+static void RecordPath(StochasticStatsScope &stats, const Vector &parameter) {
+	if (parameter.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		stats.ConstantPath();
+	} else {
+		stats.PerRowPath();
+	}
+}
+
+// The concentration parameters of all valid rows are gathered into one array, which is drawn
+// as Gamma(alpha_j, 1) variates STANDARD_VECTOR_SIZE at a time straight into the children of the
+// result; each row is then divided by its sum.
+static void DirichletFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	const idx_t count = args.size();
+	StochasticStatsScope stats(state, count);
+	RecordPath(stats, args.data[0]);
+	const ListParameter alpha(args.data[0], count);
+	const bool null_on_invalid = StochasticFunctionLocalState::NullOnInvalid(state);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto entries = FlatVector::GetData<list_entry_t>(result);
+	vector<double> shapes;
+	for (idx_t i = 0; i < count; i++) {
+		const idx_t offset = shapes.size();
+		if (!alpha.Append(i, shapes)) {
+			SetNullRow(result, i, offset);
+			continue;
+		}
+		entries[i] = list_entry_t(offset, shapes.size() - offset);
+		if (entries[i].length == 0) {
+			RaiseOrSetNull(state, null_on_invalid, "dirichlet: Concentration parameters must not be empty", result,
+			               i, offset);
+		}
+		for (idx_t k = offset; k < shapes.size(); k++) {
+			if (!(shapes[k] > 0) || std::isinf(shapes[k])) {
+				RaiseOrSetNull(state, null_on_invalid,
+				               "dirichlet: Concentration parameters must be > 0 and finite was: " +
+				                   std::to_string(shapes[k]),
+				               result, i, offset);
+				break;
+			}
+		}
+		if (FlatVector::IsNull(result, i)) {
+			shapes.resize(offset);
+		}
+	}
+
+	const idx_t total = shapes.size();
+	ListVector::Reserve(result, total);
+	ListVector::SetListSize(result, total);
+	auto out = FlatVector::GetData<double>(ListVector::GetEntry(result));
+	for (idx_t offset = 0; offset < total; offset += STANDARD_VECTOR_SIZE) {
+		const idx_t batch = std::min<idx_t>(STANDARD_VECTOR_SIZE, total - offset);
+		SampleStandardGamma(batch, shapes.data() + offset, out + offset);
+	}
+
+	for (idx_t i = 0; i < count; i++) {
+		if (FlatVector::IsNull(result, i)) {
+			continue;
+		}
+		const auto &entry = entries[i];
+		double *row = out + entry.offset;
+		double sum = 0;
+		for (idx_t k = 0; k < entry.length; k++) {
+			sum += row[k];
+		}
+		if (sum > 0) {
+			for (idx_t k = 0; k < entry.length; k++) {
+				row[k] /= sum;
+			}
+			continue;
+		}
+		// Every variate underflowed, which takes concentrations far below 1. The limit of the
+		// distribution as they vanish puts all mass on component j with probability alpha_j / sum.
+		const double *row_alpha = shapes.data() + entry.offset;
+		double alpha_sum = 0;
+		for (idx_t k = 0; k < entry.length; k++) {
+			alpha_sum += row_alpha[k];
+		}
+		double u;
+		FillUniformOpen01(&u, 1);
+		double target = u * alpha_sum;
+		idx_t chosen = entry.length - 1;
+		for (idx_t k = 0; k + 1 < entry.length; k++) {
+			target -= row_alpha[k];
+			if (target < 0) {
+				chosen = k;
+				break;
+			}
+		}
+		row[chosen] = 1;
+	}
+}
+
+// A row of dist_multinomial_sample in the middle of the conditional binomial method.
+struct MultinomialRow {
+	// First component of the row in the result and in the gathered probabilities.
+	idx_t offset;
+	idx_t length;
+	// Trials not yet assigned to a component.
+	double remaining;
+};
+
+// Conditional binomial method: component j of a row is Binomial(remaining, p_j / (p_j + ... + p_k))
+// and the last one takes the trials left. The components are drawn in rounds, round j drawing
+// component j of every row that still has trials left with one call of the batch binomial sampler.
+// A row leaves the rounds once its trials are used up, its later components staying 0.
+static void MultinomialFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	const idx_t count = args.size();
+	StochasticStatsScope stats(state, count);
+	auto &trials_vector = args.data[0];
+	auto &prob_vector = args.data[1];
+	if (trials_vector.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		RecordPath(stats, prob_vector);
+	} else {
+		stats.PerRowPath();
+	}
+	UnifiedVectorFormat trials_data;
+	trials_vector.ToUnifiedFormat(count, trials_data);
+	const auto trials = UnifiedVectorFormat::GetData<int64_t>(trials_data);
+	const ListParameter prob(prob_vector, count);
+	const bool null_on_invalid = StochasticFunctionLocalState::NullOnInvalid(state);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto entries = FlatVector::GetData<list_entry_t>(result);
+	// tails[j] is p_j + ... + p_k of the row of j, summed from the end so the conditional
+	// probabilities of the last components are not left with the rounding of the whole sum.
+	vector<double> tails;
+	vector<MultinomialRow> rows;
+	for (idx_t i = 0; i < count; i++) {
+		const idx_t offset = tails.size();
+		const auto trials_index = trials_data.sel->get_index(i);
+		if (!trials_data.validity.RowIsValid(trials_index) || !prob.Append(i, tails)) {
+			SetNullRow(result, i, offset);
+			continue;
+		}
+		const idx_t length = tails.size() - offset;
+		entries[i] = list_entry_t(offset, length);
+		string error;
+		if (trials[trials_index] < 0) {
+			error = "multinomial: Number of trials must be >= 0 was: " + std::to_string(trials[trials_index]);
+		} else if (length == 0) {
+			error = "multinomial: Probabilities must not be empty";
+		}
+		for (idx_t k = offset; error.empty() && k < tails.size(); k++) {
+			if (!(tails[k] >= 0 && tails[k] <= 1)) {
+				error = "multinomial: Probability must be in [0, 1] was: " + std::to_string(tails[k]);
+			}
+		}
+		for (idx_t k = tails.size() - 1; error.empty() && k > offset; k--) {
+			tails[k - 1] += tails[k];
+		}
+		if (error.empty() && std::abs(tails[offset] - 1) > MULTINOMIAL_SUM_TOLERANCE) {
+			error = "multinomial: Probabilities must sum to 1 was: " + std::to_string(tails[offset]);
+		}
+		if (!error.empty()) {
+			RaiseOrSetNull(state, null_on_invalid, error, result, i, offset);
+			tails.resize(offset);
+			continue;
+		}
+		rows.push_back(MultinomialRow {offset, length, double(trials[trials_index])});
+	}
+
+	const idx_t total = tails.size();
+	ListVector::Reserve(result, total);
+	ListVector::SetListSize(result, total);
+	auto out = FlatVector::GetData<int64_t>(ListVector::GetEntry(result));
+	std::fill_n(out, total, 0);
+
+	// There is at most one row per result row, so a round fits in one batch.
+	double batch_trials[STANDARD_VECTOR_SIZE];
+	double batch_prob[STANDARD_VECTOR_SIZE];
+	double draws[STANDARD_VECTOR_SIZE];
+	vector<idx_t> active(rows.size());
+	for (idx_t r = 0; r < rows.size(); r++) {
+		active[r] = r;
+	}
+	for (idx_t j = 0; !active.empty(); j++) {
+		idx_t batch = 0;
+		for (auto r : active) {
+			auto &row = rows[r];
+			if (row.remaining == 0) {
+				continue;
+			}
+			if (j + 1 == row.length) {
+				out[row.offset + j] = int64_t(row.remaining);
+				continue;
+			}
+			// With the probabilities summed from the end tails[j] - tails[j + 1] is p_j, and
+			// the ratio stays in [0, 1] up to rounding.
+			const double tail = tails[row.offset + j];
+			const double p = tail - tails[row.offset + j + 1];
+			batch_trials[batch] = row.remaining;
+			batch_prob[batch] = tail > 0 ? std::min(1.0, std::max(0.0, p / tail)) : 0;
+			active[batch++] = r;
+		}
+		active.resize(batch);
+		binomial_sampler<>::SampleBatch(batch, batch_trials, batch_prob, draws);
+		for (idx_t b = 0; b < batch; b++) {
+			auto &row = rows[active[b]];
+			out[row.offset + j] = int64_t(draws[b]);
+			row.remaining -= draws[b];
+		}
+	}
+}
+
+void LoadDirichletMultinomial(ExtensionLoader &loader) {
+	const auto prob_list = LogicalType::LIST(LogicalType::DOUBLE);
+
+	StochasticStats::RegisterFunctionName(DIRICHLET_NAME);
+	ScalarFunction dirichlet(DIRICHLET_NAME, {prob_list}, prob_list, DirichletFunction, nullptr, nullptr, nullptr,
+	                         StochasticFunctionLocalState::Init, LogicalTypeId::INVALID, FunctionStability::VOLATILE,
+	                         FunctionNullHandling::DEFAULT_NULL_HANDLING, nullptr);
+	CreateScalarFunctionInfo dirichlet_info(dirichlet);
+	FunctionDescription dirichlet_desc;
+	dirichlet_desc.description = "Generates a random sample of the Dirichlet distribution with the given "
+	                             "concentration parameters, a list of positive numbers; the sample is a list of "
+	                             "as many proportions, which sum to 1.";
+	dirichlet_desc.examples.push_back(string(DIRICHLET_NAME) + "([1.0, 2.0, 3.0])");
+	dirichlet_desc.parameter_types = {prob_list};
+	dirichlet_desc.parameter_names = {"alpha"};
+	dirichlet_info.descriptions.push_back(dirichlet_desc);
+	loader.RegisterFunction(dirichlet_info);
+
+	StochasticStats::RegisterFunctionName(MULTINOMIAL_NAME);
+	ScalarFunction multinomial(MULTINOMIAL_NAME, {LogicalType::BIGINT, prob_list},
+	                           LogicalType::LIST(LogicalType::BIGINT), MultinomialFunction, nullptr, nullptr, nullptr,
+	                           StochasticFunctionLocalState::Init, LogicalTypeId::INVALID,
+	                           FunctionStability::VOLATILE, FunctionNullHandling::DEFAULT_NULL_HANDLING, nullptr);
+	CreateScalarFunctionInfo multinomial_info(multinomial);
+	FunctionDescription multinomial_desc;
+	multinomial_desc.description = "Generates a random sample of the multinomial distribution: the counts of n "
+	                               "trials falling into categories with the given probabilities, which sum to 1.";
+	multinomial_desc.examples.push_back(string(MULTINOMIAL_NAME) + "(100, [0.2, 0.3, 0.5])");
+	multinomial_desc.parameter_types = {LogicalType::BIGINT, prob_list};
+	multinomial_desc.parameter_names = {"n", "p"};
+	multinomial_info.descriptions.push_back(multinomial_desc);
+	loader.RegisterFunction(multinomial_info);
+}
+
+} // namespace duckdb
@@ -0,0 +1,427 @@
+#include "stochastic_distribution_type.hpp"
+#include "function_state.hpp"
+#include "stochastic_stats.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include <duckdb/parser/parsed_data/create_scalar_function_info.hpp>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+namespace duckdb {
+
+namespace {
+
+struct DistributionKernel {
+	vector<LogicalType> arg_types;
+	vector<string> param_names;
+	LogicalType return_type;
+	scalar_function_t function;
+};
+
+struct KernelRegistry {
+	std::mutex lock;
+	// Keyed by the full function name, dist_<family>_<kernel>.
+	std::unordered_map<string, shared_ptr<const DistributionKernel>> kernels;
+
+	static KernelRegistry &Get() {
+		static auto registry = new KernelRegistry();
+		return *registry;
+	}
+};
+
+} // namespace
+
+LogicalType DistributionValueType() {
+	Vector families(LogicalType::VARCHAR, DISTRIBUTION_FAMILY_COUNT);
+	auto family_names = FlatVector::GetData<string_t>(families);
+	for (idx_t tag = 0; tag < DISTRIBUTION_FAMILY_COUNT; tag++) {
+		family_names[tag] = StringVector::AddString(families, DISTRIBUTION_FAMILIES[tag]);
+	}
+	child_list_t<LogicalType> children;
+	children.emplace_back("family", LogicalType::ENUM(families, DISTRIBUTION_FAMILY_COUNT));
+	children.emplace_back("param1", LogicalType::DOUBLE);
+	children.emplace_back("param2", LogicalType::DOUBLE);
+	auto type = LogicalType::STRUCT(std::move(children));
+	type.SetAlias(DISTRIBUTION_TYPE_NAME);
+	return type;
+}
+
+idx_t DistributionFamilyTag(const string &family) {
+	for (idx_t tag = 0; tag < DISTRIBUTION_FAMILY_COUNT; tag++) {
+		if (family == DISTRIBUTION_FAMILIES[tag]) {
+			return tag;
+		}
+	}
+	return DConstants::INVALID_INDEX;
+}
+
+bool IsDistributionKernel(const string &kernel) {
+	for (auto name : DISTRIBUTION_KERNELS) {
+		if (kernel == name) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void RegisterDistributionKernel(const string &family, const string &kernel, const vector<LogicalType> &arg_types,
+                                const vector<string> &param_names, const LogicalType &return_type,
+                                scalar_function_t function) {
+	auto &registry = KernelRegistry::Get();
+	std::lock_guard<std::mutex> guard(registry.lock);
+	auto name = "dist_" + family + "_" + kernel;
+	if (registry.kernels.find(name) == registry.kernels.end()) {
+		registry.kernels[name] = make_shared_ptr<DistributionKernel>(
+		    DistributionKernel {arg_types, param_names, return_type, std::move(function)});
+	}
+}
+
+// The kernel of every family for one generic function, resolved from the registry at bind time.
+struct DistributionDispatchData : public FunctionData {
+	std::array<shared_ptr<const DistributionKernel>, DISTRIBUTION_FAMILY_COUNT> kernels;
+
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<DistributionDispatchData>(*this);
+	}
+	bool Equals(const FunctionData &other) const override {
+		auto &other_kernels = other.Cast<DistributionDispatchData>().kernels;
+		for (idx_t tag = 0; tag < DISTRIBUTION_FAMILY_COUNT; tag++) {
+			if (kernels[tag].get() != other_kernels[tag].get()) {
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+static unique_ptr<FunctionData> DistributionDispatchBind(ClientContext &context, ScalarFunction &bound_function,
+                                                         vector<unique_ptr<Expression>> &arguments) {
+	// The generic functions are named dist_<kernel>.
+	const auto kernel = bound_function.name.substr(5);
+	auto result = make_uniq<DistributionDispatchData>();
+	auto &registry = KernelRegistry::Get();
+	std::lock_guard<std::mutex> guard(registry.lock);
+	for (idx_t tag = 0; tag < DISTRIBUTION_FAMILY_COUNT; tag++) {
+		auto entry = registry.kernels.find("dist_" + string(DISTRIBUTION_FAMILIES[tag]) + "_" + kernel);
+		if (entry != registry.kernels.end()) {
+			result->kernels[tag] = entry->second;
+		}
+	}
+	return std::move(result);
+}
+
+// Runs one family's kernel on count rows. params are the DOUBLE parameter vectors and extra the
+// remaining argument (x or p), if any; with a selection only the selected rows are passed, else
+// the vectors are passed whole, constant vectors staying constant. Arguments are cast to the
+// kernel's types; the result is left in the kernel's return type.
+static void RunDistributionKernel(const DistributionKernel &kernel, ExpressionState &state, Vector *params[2],
+                                  optional_ptr<Vector> extra, optional_ptr<const SelectionVector> sel, idx_t count,
+                                  Vector &result) {
+	DataChunk group;
+	group.InitializeEmpty(kernel.arg_types);
+	const idx_t param_count = kernel.arg_types.size() - (extra ? 1 : 0);
+	for (idx_t j = 0; j < kernel.arg_types.size(); j++) {
+		auto &source = j < param_count ? *params[j] : *extra;
+		Vector selected = sel ? Vector(source, *sel, count) : Vector(source);
+		if (selected.GetType() == kernel.arg_types[j]) {
+			group.data[j].Reference(selected);
+		} else {
+			Vector cast(kernel.arg_types[j], count);
+			VectorOperations::DefaultCast(selected, cast, count);
+			group.data[j].Reference(cast);
+		}
+	}
+	group.SetCardinality(count);
+	kernel.function(group, state, result);
+}
+
+[[noreturn]] static void RaiseMissingKernel(ExpressionState &state, idx_t tag) {
+	auto &function_name = state.expr.Cast<BoundFunctionExpression>().function.name;
+	throw InvalidInputException("%s is not available for the %s distribution", function_name,
+	                            DISTRIBUTION_FAMILIES[tag]);
+}
+
+// Partitions the chunk by family with a counting sort of row_family(i), the tag of row i or
+// DISTRIBUTION_FAMILY_COUNT for a NULL row, and runs each family's kernel once on its rows. A chunk
+// of a single family goes to the kernel without slicing so its constant paths apply.
+template <typename RowFamily>
+static void DispatchFamilies(const DistributionDispatchData &data, ExpressionState &state, idx_t count,
+                             RowFamily row_family, Vector *params[2], optional_ptr<Vector> extra, Vector &result) {
+	if (count == 0) {
+		return;
+	}
+	std::array<idx_t, DISTRIBUTION_FAMILY_COUNT + 1> family_counts {};
+	for (idx_t i = 0; i < count; i++) {
+		family_counts[row_family(i)]++;
+	}
+
+	for (idx_t tag = 0; tag < DISTRIBUTION_FAMILY_COUNT; tag++) {
+		if (family_counts[tag] == count) {
+			if (!data.kernels[tag]) {
+				RaiseMissingKernel(state, tag);
+			}
+			auto &kernel = *data.kernels[tag];
+			if (kernel.return_type == result.GetType()) {
+				RunDistributionKernel(kernel, state, params, extra, nullptr, count, result);
+			} else {
+				Vector kernel_result(kernel.return_type, count);
+				RunDistributionKernel(kernel, state, params, extra, nullptr, count, kernel_result);
+				VectorOperations::DefaultCast(kernel_result, result, count);
+			}
+			return;
+		}
+	}
+
+	// Lay the rows of each family out contiguously in one selection.
+	std::array<idx_t, DISTRIBUTION_FAMILY_COUNT + 1> family_starts {};
+	for (idx_t tag = 1; tag <= DISTRIBUTION_FAMILY_COUNT; tag++) {
+		family_starts[tag] = family_starts[tag - 1] + family_counts[tag - 1];
+	}
+	SelectionVector order(count);
+	auto positions = family_starts;
+	for (idx_t i = 0; i < count; i++) {
+		order.set_index(positions[row_family(i)]++, i);
+	}
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	const auto results = FlatVector::GetData<double>(result);
+	auto &result_validity = FlatVector::Validity(result);
+	for (idx_t i = family_starts[DISTRIBUTION_FAMILY_COUNT]; i < count; i++) {
+		result_validity.SetInvalid(order.get_index(i));
+	}
+	for (idx_t tag = 0; tag < DISTRIBUTION_FAMILY_COUNT; tag++) {
+		const auto family_count = family_counts[tag];
+		if (family_count == 0) {
+			continue;
+		}
+		if (!data.kernels[tag]) {
+			RaiseMissingKernel(state, tag);
+		}
+		auto &kernel = *data.kernels[tag];
+		SelectionVector family_sel(order.data() + family_starts[tag]);
+		Vector kernel_result(kernel.return_type, family_count);
+		RunDistributionKernel(kernel, state, params, extra, &family_sel, family_count, kernel_result);
+		Vector family_result(LogicalType::DOUBLE, family_count);
+		if (kernel.return_type == LogicalType::DOUBLE) {
+			family_result.Reference(kernel_result);
+		} else {
+			VectorOperations::DefaultCast(kernel_result, family_result, family_count);
+		}
+
+		// Scatter the family's results back to its rows.
+		UnifiedVectorFormat family_data;
+		family_result.ToUnifiedFormat(family_count, family_data);
+		const auto family_values = UnifiedVectorFormat::GetData<double>(family_data);
+		for (idx_t k = 0; k < family_count; k++) {
+			const auto row = family_sel.get_index(k);
+			const auto index = family_data.sel->get_index(k);
+			if (family_data.validity.RowIsValid(index)) {
+				results[row] = family_values[index];
+			} else {
+				result_validity.SetInvalid(row);
+			}
+		}
+	}
+}
+
+// dist_<kernel>(DISTRIBUTION[, x]). A constant DISTRIBUTION keeps its parameter vectors constant.
+static void DistributionDispatchFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &data = state.expr.Cast<BoundFunctionExpression>().bind_info->Cast<DistributionDispatchData>();
+	const idx_t count = args.size();
+	auto &value_vector = args.data[0];
+	optional_ptr<Vector> extra = args.ColumnCount() > 1 ? &args.data[1] : nullptr;
+
+	if (value_vector.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		if (ConstantVector::IsNull(value_vector)) {
+			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+			ConstantVector::SetNull(result, true);
+			return;
+		}
+	} else {
+		value_vector.Flatten(count);
+	}
+	auto &children = StructVector::GetEntries(value_vector);
+	Vector *params[2] = {children[1].get(), children[2].get()};
+	UnifiedVectorFormat value_data;
+	UnifiedVectorFormat tag_data;
+	value_vector.ToUnifiedFormat(count, value_data);
+	children[0]->ToUnifiedFormat(count, tag_data);
+	const auto tags = UnifiedVectorFormat::GetData<uint8_t>(tag_data);
+
+	// The family of each row, NULL rows (and NULL tags) under the extra last bucket.
+	auto row_family = [&](idx_t i) -> idx_t {
+		const auto tag_index = tag_data.sel->get_index(i);
+		if (!value_data.validity.RowIsValid(value_data.sel->get_index(i)) || !tag_data.validity.RowIsValid(tag_index)) {
+			return DISTRIBUTION_FAMILY_COUNT;
+		}
+		return tags[tag_index];
+	};
+	DispatchFamilies(data, state, count, row_family, params, extra, result);
+}
+
+// dist_<kernel>(family, params[, x]): the family named per row, as a model registry stores it,
+// with its parameters in a list. Names are resolved to tags and the lists unpacked into parameter
+// vectors, then the chunk is dispatched as for a DISTRIBUTION; the family's function checks the
+// parameters. An unknown family, a list of the wrong length or a fractional (or non-finite) value
+// for an integer parameter raises, or gives NULL when stochastic_error_mode is 'null'; the cast to
+// the parameter's type would otherwise round it silently.
+static void FamilyDispatchFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &data = expr.bind_info->Cast<DistributionDispatchData>();
+	const idx_t count = args.size();
+	auto &family_vector = args.data[0];
+	auto &list_vector = args.data[1];
+	optional_ptr<Vector> extra = args.ColumnCount() > 2 ? &args.data[2] : nullptr;
+	const bool constant = family_vector.GetVectorType() == VectorType::CONSTANT_VECTOR &&
+	                      list_vector.GetVectorType() == VectorType::CONSTANT_VECTOR;
+
+	UnifiedVectorFormat family_data;
+	UnifiedVectorFormat list_data;
+	UnifiedVectorFormat element_data;
+	family_vector.ToUnifiedFormat(count, family_data);
+	list_vector.ToUnifiedFormat(count, list_data);
+	auto &elements = ListVector::GetEntry(list_vector);
+	elements.ToUnifiedFormat(ListVector::GetListSize(list_vector), element_data);
+	const auto family_names = UnifiedVectorFormat::GetData<string_t>(family_data);
+	const auto list_entries = UnifiedVectorFormat::GetData<list_entry_t>(list_data);
+	const auto element_entries = UnifiedVectorFormat::GetData<double>(element_data);
+
+	Vector param1(LogicalType::DOUBLE, count);
+	Vector param2(LogicalType::DOUBLE, count);
+	double *param_values[2] = {FlatVector::GetData<double>(param1), FlatVector::GetData<double>(param2)};
+	uint8_t families[STANDARD_VECTOR_SIZE];
+	const bool null_on_invalid = StochasticFunctionLocalState::NullOnInvalid(state);
+
+	// Registries list the same family on many consecutive rows, so the last name is remembered.
+	string_t last_name;
+	idx_t last_tag = DConstants::INVALID_INDEX;
+	bool has_last = false;
+	for (idx_t i = 0; i < (constant ? 1 : count); i++) {
+		families[i] = DISTRIBUTION_FAMILY_COUNT;
+		const auto family_index = family_data.sel->get_index(i);
+		const auto list_index = list_data.sel->get_index(i);
+		if (!family_data.validity.RowIsValid(family_index) || !list_data.validity.RowIsValid(list_index)) {
+			continue;
+		}
+		const auto &name = family_names[family_index];
+		if (!has_last || name.GetSize() != last_name.GetSize() ||
+		    memcmp(name.GetData(), last_name.GetData(), name.GetSize()) != 0) {
+			last_name = name;
+			last_tag = DistributionFamilyTag(StringUtil::Lower(name.GetString()));
+			has_last = true;
+		}
+		const auto tag = last_tag;
+		if (tag == DConstants::INVALID_INDEX) {
+			if (!null_on_invalid) {
+				throw InvalidInputException("%s: unknown distribution family '%s'", expr.function.name,
+				                            name.GetString());
+			}
+			continue;
+		}
+		if (!data.kernels[tag]) {
+			RaiseMissingKernel(state, tag);
+		}
+		const auto &kernel = *data.kernels[tag];
+		const idx_t param_count = kernel.arg_types.size() - (extra ? 1 : 0);
+		const auto &list = list_entries[list_index];
+		if (list.length != param_count) {
+			if (!null_on_invalid) {
+				throw InvalidInputException("%s: the %s distribution takes %llu parameters, got %llu",
+				                            expr.function.name, DISTRIBUTION_FAMILIES[tag], param_count, list.length);
+			}
+			continue;
+		}
+		bool params_valid = true;
+		for (idx_t j = 0; j < param_count; j++) {
+			const auto element_index = element_data.sel->get_index(list.offset + j);
+			if (!element_data.validity.RowIsValid(element_index)) {
+				params_valid = false;
+				continue;
+			}
+			const double value = element_entries[element_index];
+			if (kernel.arg_types[j].IsIntegral() && !(std::isfinite(value) && value == std::floor(value))) {
+				if (!null_on_invalid) {
+					throw InvalidInputException("%s: %s must be an integer was: %s", DISTRIBUTION_FAMILIES[tag],
+					                            kernel.param_names[j], std::to_string(value));
+				}
+				params_valid = false;
+			}
+			param_values[j][i] = value;
+		}
+		if (params_valid) {
+			families[i] = uint8_t(tag);
+		}
+	}
+
+	if (constant) {
+		param1.SetVectorType(VectorType::CONSTANT_VECTOR);
+		param2.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+	Vector *params[2] = {&param1, &param2};
+	auto row_family = [&](idx_t i) -> idx_t {
+		return families[constant ? 0 : i];
+	};
+	DispatchFamilies(data, state, count, row_family, params, extra, result);
+}
+
+static void RegisterDispatchFunction(ExtensionLoader &loader, const string &name, const vector<LogicalType> &arguments,
+                                     const vector<string> &parameter_names, scalar_function_t function,
+                                     FunctionStability stability, const string &description, const string &example) {
+	ScalarFunction scalar_function(name, arguments, LogicalType::DOUBLE, std::move(function), DistributionDispatchBind,
+	                               nullptr, nullptr, StochasticFunctionLocalState::Init, LogicalTypeId::INVALID,
+	                               stability, FunctionNullHandling::DEFAULT_NULL_HANDLING, nullptr);
+	CreateScalarFunctionInfo info(scalar_function);
+	info.on_conflict = OnCreateConflict::ALTER_ON_CONFLICT;
+	FunctionDescription desc;
+	desc.description = description;
+	desc.examples.push_back(example);
+	desc.parameter_types = arguments;
+	desc.parameter_names = parameter_names;
+	info.descriptions.push_back(desc);
+	loader.RegisterFunction(info);
+}
+
+void LoadDistributionType(ExtensionLoader &loader) {
+	const auto value_type = DistributionValueType();
+	loader.RegisterType(DISTRIBUTION_TYPE_NAME, value_type);
+
+	for (auto kernel : DISTRIBUTION_KERNELS) {
+		const auto name = "dist_" + string(kernel);
+		const bool sample = string(kernel) == "sample";
+		const auto stability = sample ? FunctionStability::VOLATILE : FunctionStability::CONSISTENT;
+		const auto extra_name = string(kernel).find("quantile") == 0 ? "p" : "x";
+		StochasticStats::RegisterFunctionName(name);
+
+		vector<LogicalType> arguments {value_type};
+		vector<string> parameter_names {"distribution"};
+		if (!sample) {
+			arguments.push_back(LogicalType::DOUBLE);
+			parameter_names.push_back(extra_name);
+		}
+		RegisterDispatchFunction(loader, name, arguments, parameter_names, DistributionDispatchFunction, stability,
+		                         "Evaluates dist_<family>_" + string(kernel) +
+		                             " of the family held by a DISTRIBUTION value. Rows of a chunk are grouped by "
+		                             "family and each family's function runs once per group.",
+		                         sample ? name + "(dist_normal(0.0, 1.0))" : name + "(dist_normal(0.0, 1.0), 0.5)");
+
+		arguments = {LogicalType::VARCHAR, LogicalType::LIST(LogicalType::DOUBLE)};
+		parameter_names = {"family", "params"};
+		if (!sample) {
+			arguments.push_back(LogicalType::DOUBLE);
+			parameter_names.push_back(extra_name);
+		}
+		RegisterDispatchFunction(loader, name, arguments, parameter_names, FamilyDispatchFunction, stability,
+		                         "Evaluates dist_<family>_" + string(kernel) +
+		                             " for the family named by the first argument, with its parameters in a list. "
+		                             "Rows of a chunk are grouped by family and each family's function runs once "
+		                             "per group.",
+		                         sample ? name + "('normal', [0.0, 1.0])" : name + "('normal', [0.0, 1.0], 0.5)");
+	}
+}
+
+} // namespace duckdb
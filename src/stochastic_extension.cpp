@@ -9,6 +9,12 @@
 #include <random>
 #include <thread>
 #include "utils.hpp"
+#include "stochastic_stats.hpp"
+#include "stochastic_cache.hpp"
+#include "stochastic_distribution_type.hpp"
+#include "stochastic_multivariate_normal.hpp"
+#include "stochastic_dirichlet_multinomial.hpp"
+#include "stochastic_copula.hpp"
 #include "query_farm_telemetry.hpp"
 #include "version.hpp"
 
@@ -17,12 +23,14 @@ namespace duckdb {
 void Load_bernoulli_distribution(ExtensionLoader &loader);
 void Load_beta_distribution(ExtensionLoader &loader);
 void Load_binomial_distribution(ExtensionLoader &loader);
+void Load_cauchy_distribution(ExtensionLoader &loader);
 void Load_chi_squared_distribution(ExtensionLoader &loader);
 void Load_exponential_distribution(ExtensionLoader &loader);
 void Load_extreme_value_distribution(ExtensionLoader &loader);
 void Load_fisher_f_distribution(ExtensionLoader &loader);
 void Load_gamma_distribution(ExtensionLoader &loader);
 void Load_geometric_distribution(ExtensionLoader &loader);
+void Load_hypergeometric_distribution(ExtensionLoader &loader);
 void Load_laplace_distribution(ExtensionLoader &loader);
 void Load_logistic_distribution(ExtensionLoader &loader);
 void Load_lognormal_distribution(ExtensionLoader &loader);
@@ -35,17 +43,22 @@ void Load_students_t_distribution(ExtensionLoader &loader);
 void Load_uniform_int_distribution(ExtensionLoader &loader);
 void Load_uniform_real_distribution(ExtensionLoader &loader);
 void Load_weibull_distribution(ExtensionLoader &loader);
+void Load_zipf_distribution(ExtensionLoader &loader);
 
 static void LoadInternal(ExtensionLoader &loader) {
+	LoadStochasticSettings(loader);
+
 	Load_bernoulli_distribution(loader);
 	Load_beta_distribution(loader);
 	Load_binomial_distribution(loader);
+	Load_cauchy_distribution(loader);
 	Load_chi_squared_distribution(loader);
 	Load_exponential_distribution(loader);
 	Load_extreme_value_distribution(loader);
 	Load_fisher_f_distribution(loader);
 	Load_gamma_distribution(loader);
 	Load_geometric_distribution(loader);
+	Load_hypergeometric_distribution(loader);
 	Load_laplace_distribution(loader);
 	Load_logistic_distribution(loader);
 	Load_lognormal_distribution(loader);
@@ -58,6 +71,14 @@ static void LoadInternal(ExtensionLoader &loader) {
 	Load_uniform_int_distribution(loader);
 	Load_uniform_real_distribution(loader);
 	Load_weibull_distribution(loader);
+	Load_zipf_distribution(loader);
+
+	LoadStochasticStats(loader);
+	LoadStochasticCache(loader);
+	LoadDistributionType(loader);
+	LoadMultivariateNormal(loader);
+	LoadDirichletMultinomial(loader);
+	LoadCopula(loader);
 
 	QueryFarmSendTelemetry(loader, "stochastic", STOCHASTIC_VERSION);
 }
@@ -0,0 +1,299 @@
+#include "stochastic_multivariate_normal.hpp"
+#include "function_state.hpp"
+#include "stochastic_stats.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include <duckdb/parser/parsed_data/create_scalar_function_info.hpp>
+#include <atomic>
+
+namespace duckdb {
+
+static constexpr const char *MULTIVARIATE_NORMAL_NAME = "dist_mvnormal_sample";
+
+// The dimension of the distribution, and the factor of its covariance when the covariance is known
+// at bind time: always for the table function, for the scalar function when it is a constant.
+struct MultivariateNormalBindData : public FunctionData {
+	explicit MultivariateNormalBindData(idx_t dimension) : dimension(dimension) {
+	}
+
+	idx_t dimension;
+	shared_ptr<const CholeskyFactor> factor;
+	// Table function only: the mean and the number of samples.
+	vector<double> mean;
+	idx_t rows = 0;
+
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<MultivariateNormalBindData>(*this);
+	}
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = other_p.Cast<MultivariateNormalBindData>();
+		return dimension == other.dimension && factor == other.factor && mean == other.mean && rows == other.rows;
+	}
+};
+
+// The covariance rows were last factored for, kept per thread so a covariance column whose value
+// repeats is factored once rather than once per row or per chunk.
+struct MultivariateNormalLocalState : public StochasticFunctionLocalState {
+	using StochasticFunctionLocalState::StochasticFunctionLocalState;
+
+	vector<double> covariance;
+	CholeskyFactor factor;
+	// The covariance is symmetric positive semidefinite and factor holds its factor.
+	bool valid = false;
+
+	static unique_ptr<FunctionLocalState> Init(ExpressionState &state, const BoundFunctionExpression &expr,
+	                                           FunctionData *bind_data) {
+		auto settings = StochasticFunctionLocalState::Init(state, expr, bind_data);
+		auto &base = settings->Cast<StochasticFunctionLocalState>();
+		return make_uniq<MultivariateNormalLocalState>(base.function_id, base.precision, base.error_mode,
+		                                               base.cache_size);
+	}
+};
+
+[[noreturn]] static void RaiseInvalidCovariance() {
+	throw InvalidInputException("mvnormal: Covariance matrix must be symmetric positive semidefinite");
+}
+
+// dist_mvnormal_sample(mean, cov): the dimension comes from the type of the mean, DOUBLE[d], or from
+// its value when it is a constant list. The arguments are cast to DOUBLE[d] and DOUBLE[d][d], and a
+// constant covariance is factored here once for the whole query.
+static unique_ptr<FunctionData> MultivariateNormalBind(ClientContext &context, ScalarFunction &bound_function,
+                                                       vector<unique_ptr<Expression>> &arguments) {
+	auto &mean_type = arguments[0]->return_type;
+	idx_t dimension = 0;
+	if (mean_type.id() == LogicalTypeId::ARRAY) {
+		dimension = ArrayType::GetSize(mean_type);
+	} else if (mean_type.id() == LogicalTypeId::LIST && arguments[0]->IsFoldable()) {
+		const auto mean = ExpressionExecutor::EvaluateScalar(context, *arguments[0]);
+		if (!mean.IsNull()) {
+			dimension = ListValue::GetChildren(mean).size();
+		}
+	}
+	if (dimension == 0) {
+		throw BinderException("mvnormal: The mean must be a DOUBLE[d] array or a constant list of d > 0 numbers");
+	}
+	const auto vector_type = LogicalType::ARRAY(LogicalType::DOUBLE, dimension);
+	bound_function.arguments = {vector_type, LogicalType::ARRAY(vector_type, dimension)};
+	bound_function.return_type = vector_type;
+
+	auto result = make_uniq<MultivariateNormalBindData>(dimension);
+	if (arguments[1]->IsFoldable()) {
+		// An invalid constant is left to the rows, which raise or return NULL per stochastic_error_mode.
+		vector<double> covariance;
+		auto factor = make_shared_ptr<CholeskyFactor>();
+		if (MatrixValues(ExpressionExecutor::EvaluateScalar(context, *arguments[1]), dimension, covariance) &&
+		    factor->Factor(covariance.data(), dimension)) {
+			result->factor = std::move(factor);
+		}
+	}
+	return std::move(result);
+}
+
+// The flattened elements of an ARRAY vector; row k of its unified format starts at k times the array size.
+static Vector &ArrayElements(Vector &array) {
+	auto &elements = ArrayVector::GetEntry(array);
+	elements.Flatten(ArrayVector::GetTotalSize(array));
+	return elements;
+}
+
+static bool ContainsNull(const ValidityMask &validity, idx_t offset, idx_t length) {
+	if (validity.AllValid()) {
+		return false;
+	}
+	for (idx_t k = 0; k < length; k++) {
+		if (!validity.RowIsValid(offset + k)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Rows are drawn in runs that share a factor: the whole chunk for a constant covariance, else each
+// run of rows whose covariance repeats that of the previous row. Rows with a NULL anywhere in their
+// arguments are NULL; rows with invalid parameters raise, or are NULL under stochastic_error_mode =
+// 'null'. Such rows are drawn along with their run and then masked.
+static void MultivariateNormalFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &data = state.expr.Cast<BoundFunctionExpression>().bind_info->Cast<MultivariateNormalBindData>();
+	auto &local = ExecuteFunctionState::GetFunctionState(state)->Cast<MultivariateNormalLocalState>();
+	const idx_t count = args.size();
+	const idx_t d = data.dimension;
+	StochasticStatsScope stats(state, count);
+
+	auto &mean_vector = args.data[0];
+	auto &covariance_vector = args.data[1];
+	UnifiedVectorFormat mean_data;
+	UnifiedVectorFormat covariance_data;
+	mean_vector.ToUnifiedFormat(count, mean_data);
+	covariance_vector.ToUnifiedFormat(count, covariance_data);
+	auto &mean_elements = ArrayElements(mean_vector);
+	auto &covariance_rows = ArrayElements(covariance_vector);
+	auto &covariance_elements = ArrayElements(covariance_rows);
+	const auto means = FlatVector::GetData<double>(mean_elements);
+	const auto covariances = FlatVector::GetData<double>(covariance_elements);
+	auto &mean_validity = FlatVector::Validity(mean_elements);
+	auto &row_validity = FlatVector::Validity(covariance_rows);
+	auto &element_validity = FlatVector::Validity(covariance_elements);
+
+	if (!data.factor) {
+		stats.PerRowPath();
+	} else if (mean_vector.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		stats.ConstantPath();
+	} else {
+		stats.ConstantParamsPath();
+	}
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto &result_validity = FlatVector::Validity(result);
+	const auto out = FlatVector::GetData<double>(ArrayVector::GetEntry(result));
+	const bool null_on_invalid = StochasticFunctionLocalState::NullOnInvalid(state);
+	const vector<double> zeros(d, 0);
+	const double *row_means[STANDARD_VECTOR_SIZE];
+
+	const CholeskyFactor *factor = data.factor ? data.factor.get() : &local.factor;
+	idx_t run_start = 0;
+	auto draw_run = [&](idx_t end) {
+		// Before the first factor every row of the run is NULL.
+		if (end > run_start && factor->dimension == d) {
+			SampleMultivariateNormal(*factor, row_means + run_start, end - run_start, out + run_start * d);
+		}
+		run_start = end;
+	};
+	// The covariance row whose factor local holds, within this chunk.
+	idx_t factored_index = DConstants::INVALID_INDEX;
+
+	for (idx_t i = 0; i < count; i++) {
+		row_means[i] = zeros.data();
+		const auto mean_index = mean_data.sel->get_index(i);
+		const auto covariance_index = covariance_data.sel->get_index(i);
+		if (!mean_data.validity.RowIsValid(mean_index) || !covariance_data.validity.RowIsValid(covariance_index) ||
+		    ContainsNull(mean_validity, mean_index * d, d)) {
+			result_validity.SetInvalid(i);
+			continue;
+		}
+		if (!data.factor && covariance_index != factored_index) {
+			if (ContainsNull(row_validity, covariance_index * d, d) ||
+			    ContainsNull(element_validity, covariance_index * d * d, d * d)) {
+				result_validity.SetInvalid(i);
+				continue;
+			}
+			const double *covariance = covariances + covariance_index * d * d;
+			if (local.covariance.empty() || !std::equal(covariance, covariance + d * d, local.covariance.begin())) {
+				draw_run(i);
+				local.covariance.assign(covariance, covariance + d * d);
+				local.valid = local.factor.Factor(covariance, d);
+			}
+			factored_index = covariance_index;
+		}
+
+		const double *mean = means + mean_index * d;
+		const bool mean_valid = std::all_of(mean, mean + d, [](double value) { return std::isfinite(value); });
+		if ((data.factor || local.valid) && mean_valid) {
+			row_means[i] = mean;
+		} else if (null_on_invalid) {
+			result_validity.SetInvalid(i);
+		} else {
+			CountValidationFailure(state);
+			if (!mean_valid) {
+				throw InvalidInputException("mvnormal: Mean must be finite");
+			}
+			RaiseInvalidCovariance();
+		}
+	}
+	draw_run(count);
+}
+
+// dist_mvnormal_sample(n, mean, cov) as a table function: n rows of one DOUBLE[d] column, sample.
+struct MultivariateNormalGlobalState : public GlobalTableFunctionState {
+	explicit MultivariateNormalGlobalState(idx_t rows) : rows(rows) {
+	}
+
+	idx_t rows;
+	// The first row of the next chunk; threads claim chunks from it.
+	std::atomic<idx_t> next {0};
+
+	idx_t MaxThreads() const override {
+		return rows / STANDARD_VECTOR_SIZE + 1;
+	}
+};
+
+static unique_ptr<FunctionData> MultivariateNormalTableBind(ClientContext &context, TableFunctionBindInput &input,
+                                                            vector<LogicalType> &return_types, vector<string> &names) {
+	if (input.inputs[0].IsNull() || input.inputs[0].GetValue<int64_t>() < 0) {
+		throw InvalidInputException("mvnormal: Number of samples must be >= 0");
+	}
+	vector<double> mean;
+	if (!AppendValues(input.inputs[1], mean) || mean.empty()) {
+		throw InvalidInputException("mvnormal: The mean must be a list of d > 0 numbers without NULLs");
+	}
+	for (auto value : mean) {
+		if (!std::isfinite(value)) {
+			throw InvalidInputException("mvnormal: Mean must be finite");
+		}
+	}
+	const idx_t dimension = mean.size();
+	vector<double> covariance;
+	if (!MatrixValues(input.inputs[2], dimension, covariance)) {
+		throw InvalidInputException("mvnormal: The covariance must be %llu lists of %llu numbers without NULLs",
+		                            dimension, dimension);
+	}
+	auto factor = make_shared_ptr<CholeskyFactor>();
+	if (!factor->Factor(covariance.data(), dimension)) {
+		RaiseInvalidCovariance();
+	}
+
+	auto result = make_uniq<MultivariateNormalBindData>(dimension);
+	result->factor = std::move(factor);
+	result->mean = std::move(mean);
+	result->rows = idx_t(input.inputs[0].GetValue<int64_t>());
+	names = {"sample"};
+	return_types = {LogicalType::ARRAY(LogicalType::DOUBLE, dimension)};
+	return std::move(result);
+}
+
+static unique_ptr<GlobalTableFunctionState> MultivariateNormalTableInit(ClientContext &context,
+                                                                        TableFunctionInitInput &input) {
+	return make_uniq<MultivariateNormalGlobalState>(input.bind_data->Cast<MultivariateNormalBindData>().rows);
+}
+
+static void MultivariateNormalTableFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.bind_data->Cast<MultivariateNormalBindData>();
+	auto &state = data_p.global_state->Cast<MultivariateNormalGlobalState>();
+	const idx_t start = state.next.fetch_add(STANDARD_VECTOR_SIZE);
+	if (start >= state.rows) {
+		output.SetCardinality(0);
+		return;
+	}
+	const idx_t count = std::min<idx_t>(STANDARD_VECTOR_SIZE, state.rows - start);
+	const double *means[STANDARD_VECTOR_SIZE];
+	std::fill_n(means, count, data.mean.data());
+	SampleMultivariateNormal(*data.factor, means, count,
+	                         FlatVector::GetData<double>(ArrayVector::GetEntry(output.data[0])));
+	output.SetCardinality(count);
+}
+
+void LoadMultivariateNormal(ExtensionLoader &loader) {
+	StochasticStats::RegisterFunctionName(MULTIVARIATE_NORMAL_NAME);
+	ScalarFunction function(MULTIVARIATE_NORMAL_NAME, {LogicalType::ANY, LogicalType::ANY}, LogicalType::ANY,
+	                        MultivariateNormalFunction, MultivariateNormalBind, nullptr, nullptr,
+	                        MultivariateNormalLocalState::Init, LogicalTypeId::INVALID, FunctionStability::VOLATILE,
+	                        FunctionNullHandling::DEFAULT_NULL_HANDLING, nullptr);
+	CreateScalarFunctionInfo info(function);
+	FunctionDescription desc;
+	desc.description = "Generates a random sample of the multivariate normal distribution with the given mean "
+	                   "(DOUBLE[d]) and covariance matrix (DOUBLE[d][d]), returned as DOUBLE[d]. A constant "
+	                   "covariance is factored once when the query is bound.";
+	desc.examples.push_back(string(MULTIVARIATE_NORMAL_NAME) + "([0.0, 0.0], [[1.0, 0.5], [0.5, 1.0]])");
+	desc.parameter_types = {LogicalType::ANY, LogicalType::ANY};
+	desc.parameter_names = {"mean", "cov"};
+	info.descriptions.push_back(desc);
+	loader.RegisterFunction(info);
+
+	TableFunction table_function(MULTIVARIATE_NORMAL_NAME, {LogicalType::BIGINT, LogicalType::ANY, LogicalType::ANY},
+	                             MultivariateNormalTableFunction, MultivariateNormalTableBind,
+	                             MultivariateNormalTableInit);
+	loader.RegisterFunction(table_function);
+}
+
+} // namespace duckdb
@@ -0,0 +1,160 @@
+#include "stochastic_stats.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/client_context.hpp"
+
+namespace duckdb {
+
+namespace {
+
+// Function names by id, shared by every database of the process.
+struct FunctionNameRegistry {
+	std::mutex lock;
+	vector<string> function_names;
+	std::unordered_map<string, idx_t> function_ids;
+
+	static FunctionNameRegistry &Get() {
+		static FunctionNameRegistry registry;
+		return registry;
+	}
+};
+
+void AddCounters(StochasticFunctionStats &target, const StochasticFunctionCounters &source) {
+	target.chunks += source.chunks.Load();
+	target.rows += source.rows.Load();
+	target.constant_path += source.constant_path.Load();
+	target.constant_params_path += source.constant_params_path.Load();
+	target.per_row_path += source.per_row_path.Load();
+	target.validation_failures += source.validation_failures.Load();
+	target.nanoseconds += source.nanoseconds.Load();
+}
+
+void AddCounters(vector<StochasticFunctionStats> &totals, const StochasticFunctionCounters &source) {
+	if (source.function_id >= totals.size()) {
+		totals.resize(source.function_id + 1);
+	}
+	AddCounters(totals[source.function_id], source);
+}
+
+} // namespace
+
+idx_t StochasticStats::RegisterFunctionName(const string &name) {
+	auto &registry = FunctionNameRegistry::Get();
+	std::lock_guard<std::mutex> guard(registry.lock);
+	auto entry = registry.function_ids.find(name);
+	if (entry != registry.function_ids.end()) {
+		return entry->second;
+	}
+	auto function_id = registry.function_names.size();
+	registry.function_names.push_back(name);
+	registry.function_ids[name] = function_id;
+	return function_id;
+}
+
+idx_t StochasticStats::GetFunctionId(const string &name) {
+	auto &registry = FunctionNameRegistry::Get();
+	std::lock_guard<std::mutex> guard(registry.lock);
+	auto entry = registry.function_ids.find(name);
+	if (entry == registry.function_ids.end()) {
+		return DConstants::INVALID_INDEX;
+	}
+	return entry->second;
+}
+
+optional_ptr<StochasticFunctionCounters> StochasticStats::LocalCounters(ExpressionState &state) {
+	auto local_state = StochasticFunctionLocalState::Get(state);
+	if (!local_state || local_state->function_id == DConstants::INVALID_INDEX) {
+		return nullptr;
+	}
+	if (!local_state->counters) {
+		local_state->stats = ObjectCache::GetObjectCache(state.GetContext())
+		                         .GetOrCreate<StochasticStats>(StochasticStats::ObjectType());
+		local_state->counters = &local_state->stats->Attach(local_state->function_id);
+	}
+	return local_state->counters;
+}
+
+StochasticFunctionCounters &StochasticStats::Attach(idx_t function_id) {
+	auto counters = make_uniq<StochasticFunctionCounters>(function_id);
+	auto &result = *counters;
+	std::lock_guard<std::mutex> guard(lock);
+	live.emplace(&result, std::move(counters));
+	return result;
+}
+
+void StochasticStats::Retire(StochasticFunctionCounters &counters) {
+	std::lock_guard<std::mutex> guard(lock);
+	AddCounters(retired, counters);
+	live.erase(&counters);
+}
+
+vector<StochasticFunctionStats> StochasticStats::Collect() {
+	vector<StochasticFunctionStats> totals;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		totals = retired;
+		for (auto &entry : live) {
+			AddCounters(totals, *entry.first);
+		}
+	}
+
+	auto &registry = FunctionNameRegistry::Get();
+	std::lock_guard<std::mutex> guard(registry.lock);
+	vector<StochasticFunctionStats> result;
+	for (idx_t function_id = 0; function_id < totals.size() && function_id < registry.function_names.size();
+	     function_id++) {
+		if (totals[function_id].chunks == 0) {
+			continue;
+		}
+		totals[function_id].function_name = registry.function_names[function_id];
+		result.push_back(totals[function_id]);
+	}
+	return result;
+}
+
+struct StochasticStatsGlobalState : public GlobalTableFunctionState {
+	vector<StochasticFunctionStats> entries;
+	idx_t offset = 0;
+};
+
+static unique_ptr<FunctionData> StochasticStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                    vector<LogicalType> &return_types, vector<string> &names) {
+	names = {"function_name", "chunks", "rows", "constant_path", "constant_params_path", "per_row_path",
+	         "validation_failures", "nanoseconds"};
+	return_types = {LogicalType::VARCHAR, LogicalType::UBIGINT, LogicalType::UBIGINT, LogicalType::UBIGINT,
+	                LogicalType::UBIGINT, LogicalType::UBIGINT, LogicalType::UBIGINT, LogicalType::UBIGINT};
+	return make_uniq<TableFunctionData>();
+}
+
+static unique_ptr<GlobalTableFunctionState> StochasticStatsInit(ClientContext &context,
+                                                                TableFunctionInitInput &input) {
+	auto result = make_uniq<StochasticStatsGlobalState>();
+	auto stats = ObjectCache::GetObjectCache(context).GetOrCreate<StochasticStats>(StochasticStats::ObjectType());
+	result->entries = stats->Collect();
+	return std::move(result);
+}
+
+static void StochasticStatsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<StochasticStatsGlobalState>();
+	idx_t count = 0;
+	while (state.offset < state.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = state.entries[state.offset++];
+		output.SetValue(0, count, Value(entry.function_name));
+		output.SetValue(1, count, Value::UBIGINT(entry.chunks));
+		output.SetValue(2, count, Value::UBIGINT(entry.rows));
+		output.SetValue(3, count, Value::UBIGINT(entry.constant_path));
+		output.SetValue(4, count, Value::UBIGINT(entry.constant_params_path));
+		output.SetValue(5, count, Value::UBIGINT(entry.per_row_path));
+		output.SetValue(6, count, Value::UBIGINT(entry.validation_failures));
+		output.SetValue(7, count, Value::UBIGINT(entry.nanoseconds));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void LoadStochasticStats(ExtensionLoader &loader) {
+	TableFunction stats_function("stochastic_stats", {}, StochasticStatsFunction, StochasticStatsBind,
+	                             StochasticStatsInit);
+	loader.RegisterFunction(stats_function);
+}
+
+} // namespace duckdb